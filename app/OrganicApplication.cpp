@@ -41,6 +41,9 @@ void OrganicApplication::initialise(const String & commandLine)
 {
 	initialiseInternal(commandLine);
 
+	bool benchmarkMode = EngineBenchmark::isBenchmarkRequested(commandLine);
+	if (benchmarkMode) useWindow = false; //headless
+
 	CommandLineElements commands = StringUtil::parseCommandLine(commandLine);
 	for (auto& c : commands)
 	{
@@ -69,7 +72,7 @@ void OrganicApplication::initialise(const String & commandLine)
 
 	AppUpdater::getInstance()->addAsyncUpdateListener(this);
 
-	if (GlobalSettings::getInstance()->checkUpdatesOnStartup->boolValue()) AppUpdater::getInstance()->checkForUpdates();
+	if (!benchmarkMode && GlobalSettings::getInstance()->checkUpdatesOnStartup->boolValue()) AppUpdater::getInstance()->checkForUpdates();
 
 	HelpBox::getInstance()->loadHelp();
 
@@ -87,6 +90,13 @@ void OrganicApplication::initialise(const String & commandLine)
 
 	afterInit();
 
+	if (benchmarkMode)
+	{
+		setApplicationReturnValue(EngineBenchmark::runFromCommandLine(commandLine));
+		quit();
+		return;
+	}
+
 	engine->parseCommandline(commandLine);
 
 	if (!engine->getFile().existsAsFile()) {
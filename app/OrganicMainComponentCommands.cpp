@@ -423,7 +423,7 @@ bool OrganicMainContentComponent::perform(const InvocationInfo& info) {
 			}
 
 			data.getDynamicObject()->setProperty("items", itemsData);
-			SystemClipboard::copyTextToClipboard(JSON::toString(data));
+			ControllableClipboard::getInstance()->copy(data);
 			LOG(items.size() << "items copied to clipboard");
 		}
 	}
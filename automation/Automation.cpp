@@ -12,7 +12,9 @@
 Automation::Automation(const String& name, AutomationRecorder * recorder, bool allowKeysOutside) :
     BaseManager(name),
     recorder(recorder),
-    allowKeysOutside(allowKeysOutside)
+    allowKeysOutside(allowKeysOutside),
+    isSettingKeysPosAndValues(false),
+    automationNotifier(10)
 {
     comparator.compareFunc = &Automation::compareKeys;
 
@@ -180,6 +182,10 @@ void Automation::updateNextKeys(int start, int end)
             jassert(items[i]->position->floatValue() <= items[i + 1]->position->floatValue());
             items[i]->setNextKey(items[i + 1]);
         }
+        else
+        {
+            items[i]->setNextKey(nullptr);
+        }
     }
 
     computeValue();
@@ -194,23 +200,201 @@ void Automation::setLength(float newLength, float stretch, float stickToEnd)
 {
     if (length->floatValue() == newLength) return;
 
+    Array<AutomationKey*> keys;
+    keys.addArray(items);
+
     if (stretch && length->floatValue() > 0)
     {
         float stretchFactor = newLength / length->floatValue();
         if (stretchFactor > 1) length->setValue(newLength); //if stretching, we have first to expand the length in case keys are not allowed outside
-        for (auto& k : items) k->position->setValue(k->position->floatValue() * stretchFactor);
+        transformKeys(keys, AffineTransform::scale(stretchFactor, 1));
         if (stretchFactor < 1) length->setValue(newLength); //if reducing, we have to first reduce keys and then we can reduce the length, in case keys are not allowed outside
     }
     else
     {
         float lengthDiff = newLength - length->floatValue();
         length->setValue(newLength); // just change the value, nothing unusual
-        if (stickToEnd) for (auto& k : items) k->position->setValue(k->position->floatValue() + lengthDiff);
+        if (stickToEnd) transformKeys(keys, AffineTransform::translation(lengthDiff, 0));
     }
 
     if (!allowKeysOutside) for (auto& k : items) k->position->setRange(0, length->floatValue());
 }
 
+void Automation::setKeysPosAndValues(const Array<AutomationKey*>& keys, const Array<Point<float>>& posAndValues, bool addToUndo, const Array<Point<float>>& previousPosAndValues)
+{
+    jassert(keys.size() == posAndValues.size());
+    if (keys.isEmpty()) return;
+
+    if (addToUndo)
+    {
+        Array<Point<float>> oldPosAndValues(previousPosAndValues);
+        if (oldPosAndValues.size() != keys.size())
+        {
+            oldPosAndValues.clear();
+            for (auto& k : keys) oldPosAndValues.add(k->getPosAndValue());
+        }
+
+        UndoMaster::getInstance()->performAction("Move " + String(keys.size()) + " keys", new KeysPosAndValuesAction(this, keys, oldPosAndValues, posAndValues));
+        return;
+    }
+
+    Array<AutomationKey*> changedKeys;
+    Array<Point<float>> newPosAndValues;
+    for (int i = 0; i < keys.size(); i++)
+    {
+        if (keys[i]->getPosAndValue() == posAndValues[i]) continue;
+        changedKeys.add(keys[i]);
+        newPosAndValues.add(posAndValues[i]);
+    }
+
+    if (changedKeys.isEmpty()) return;
+
+    //keys don't update their easings nor send KEY_UPDATED while this is set, it's done once here
+    bool wasSettingKeys = isSettingKeysPosAndValues;
+    isSettingKeysPosAndValues = true;
+
+    //indices are looked up while the keys are still sorted
+    Array<int> indices;
+    for (auto& k : changedKeys) indices.add(getKeyIndex(k));
+
+    Array<Point<float>> oldPosAndValues;
+    for (int i = 0; i < changedKeys.size(); i++)
+    {
+        oldPosAndValues.add(changedKeys[i]->getPosAndValue());
+        changedKeys[i]->position->setValue(newPosAndValues[i].x, true);
+        changedKeys[i]->value->setValue(newPosAndValues[i].y, true);
+    }
+
+    //most edits keep the keys in order, only then are they relocated and relinked
+    Array<AutomationKey*> movedKeys;
+    for (int i = 0; i < changedKeys.size(); i++)
+    {
+        int index = indices[i];
+        float pos = changedKeys[i]->position->floatValue();
+        bool isInPlace = (index == 0 || items[index - 1]->position->floatValue() <= pos) && (index == items.size() - 1 || pos <= items[index + 1]->position->floatValue());
+        if (!isInPlace) movedKeys.add(changedKeys[i]);
+    }
+
+    //keys whose easing depends on a changed key, may contain duplicates
+    Array<AutomationKey*> updatedKeys;
+
+    if (movedKeys.size() > jmax(items.size() / 4, 1))
+    {
+        reorderItems();
+        updateNextKeys();
+        for (auto& k : changedKeys)
+        {
+            int index = getKeyIndex(k);
+            updatedKeys.add(k);
+            if (index > 0) updatedKeys.add(items[index - 1]);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < changedKeys.size(); i++)
+        {
+            updatedKeys.add(changedKeys[i]);
+            if (indices[i] > 0) updatedKeys.add(items[indices[i] - 1]);
+        }
+
+        if (!movedKeys.isEmpty())
+        {
+            //the changed keys are taken out and inserted back at their sorted index, the other keys are still sorted.
+            //Only the changed keys and the keys before their old and new places are relinked
+            Array<int> sortedIndices(indices);
+            sortedIndices.sort();
+            for (int i = sortedIndices.size() - 1; i >= 0; i--)
+            {
+                items.remove(sortedIndices[i], false);
+                controllableContainers.remove(sortedIndices[i]);
+            }
+
+            for (auto& k : changedKeys)
+            {
+                int index = getKeyInsertIndex(k->position->floatValue());
+                items.insert(index, k);
+                controllableContainers.insert(index, k);
+            }
+
+            for (auto& k : changedKeys)
+            {
+                int index = getKeyIndex(k);
+                if (index > 0) updatedKeys.add(items[index - 1]);
+            }
+
+            for (auto& k : updatedKeys)
+            {
+                int index = getKeyIndex(k);
+                k->setNextKey(index < items.size() - 1 ? items[index + 1] : nullptr);
+            }
+
+            for (auto& k : movedKeys) notifyItemMoved(k);
+        }
+    }
+
+    updatedKeys.sort();
+    Array<AutomationKey*> uniqueUpdatedKeys;
+    for (auto& k : updatedKeys) if (uniqueUpdatedKeys.isEmpty() || uniqueUpdatedKeys.getLast() != k) uniqueUpdatedKeys.add(k);
+    for (auto& k : uniqueUpdatedKeys) k->updateEasingKeys();
+
+    computeValue();
+
+    //listeners outside the automation (feedback, scripts, editors, document changed flag) get the parameters that changed,
+    //the keys and the automation ignore them as everything is already up to date
+    Array<WeakReference<AutomationKey>> changedKeysRef;
+    for (auto& k : changedKeys) changedKeysRef.add(k);
+    for (int i = 0; i < changedKeysRef.size(); i++)
+    {
+        AutomationKey* k = changedKeysRef[i].get();
+        if (k == nullptr) continue;
+        if (k->position->floatValue() != oldPosAndValues[i].x) k->position->notifyValueChanged();
+        if (k->value->floatValue() != oldPosAndValues[i].y) k->value->notifyValueChanged();
+    }
+
+    isSettingKeysPosAndValues = wasSettingKeys;
+
+    //the UI places the updated keys from this single event
+    automationNotifier.addMessage(new AutomationEvent(AutomationEvent::KEYS_UPDATED, uniqueUpdatedKeys));
+}
+
+int Automation::getKeyIndex(AutomationKey* k)
+{
+    //dichotomy on the position, then among the keys at the same position
+    float pos = k->position->floatValue();
+    int low = 0;
+    int high = items.size();
+    while (low < high)
+    {
+        int mid = (low + high) / 2;
+        if (items[mid]->position->floatValue() < pos) low = mid + 1;
+        else high = mid;
+    }
+
+    for (int i = low; i < items.size() && items[i]->position->floatValue() == pos; i++) if (items[i] == k) return i;
+    return items.indexOf(k);
+}
+
+int Automation::getKeyInsertIndex(float pos)
+{
+    //after the keys at the same position, as reorderItem does
+    int low = 0;
+    int high = items.size();
+    while (low < high)
+    {
+        int mid = (low + high) / 2;
+        if (items[mid]->position->floatValue() <= pos) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+void Automation::transformKeys(const Array<AutomationKey*>& keys, const AffineTransform& transform, bool addToUndo)
+{
+    Array<Point<float>> posAndValues;
+    for (auto& k : keys) posAndValues.add(k->getPosAndValue().transformedBy(transform));
+    setKeysPosAndValues(keys, posAndValues, addToUndo);
+}
+
 Point<float> Automation::getPosAndValue()
 {
     return Point<float>(position->floatValue(), value->floatValue());
@@ -344,6 +528,22 @@ void Automation::onControllableStateChanged(Controllable* c)
     }
 }
 
+void Automation::onControllableFeedbackUpdate(ControllableContainer* cc, Controllable* c)
+{
+    BaseManager::onControllableFeedbackUpdate(cc, c);
+
+    if (isCurrentlyLoadingData || isManipulatingMultipleItems || isSettingKeysPosAndValues) return;
+
+    AutomationKey* k = dynamic_cast<AutomationKey*>(cc);
+    if (k == nullptr || c != k->position) return;
+
+    //a key moved past one of its neighbours, only this key is relocated and only the links around its old and new index are updated
+    int oldIndex = items.indexOf(k);
+    if (!reorderItem(k)) return;
+    int newIndex = items.indexOf(k);
+    updateNextKeys(jmin(oldIndex, newIndex) - 1, jmax(oldIndex, newIndex) + 1);
+}
+
 void Automation::afterLoadJSONDataInternal()
 {
     updateNextKeys();
@@ -357,4 +557,63 @@ int Automation::compareKeys(AutomationKey* k1, AutomationKey* k2)
 InspectableEditor* Automation::getEditor(bool isRoot)
 {
     return new AutomationEditor(this, isRoot);
+}
+
+
+Automation::AutomationEvent::AutomationEvent(Type t, Array<AutomationKey*> keys) :
+    type(t)
+{
+    for (auto& k : keys) keysRef.add(k);
+}
+
+Array<AutomationKey*> Automation::AutomationEvent::getKeys() const
+{
+    Array<AutomationKey*> result;
+    for (auto& k : keysRef)
+    {
+        if (k != nullptr && !k.wasObjectDeleted()) result.add(static_cast<AutomationKey*>(k.get()));
+    }
+    return result;
+}
+
+Automation::KeysPosAndValuesAction::KeysPosAndValuesAction(Automation* a, const Array<AutomationKey*>& keys, const Array<Point<float>>& oldPosAndValues, const Array<Point<float>>& newPosAndValues) :
+    automationRef(a),
+    oldPosAndValues(oldPosAndValues),
+    newPosAndValues(newPosAndValues)
+{
+    for (auto& k : keys) keysRef.add(k);
+}
+
+bool Automation::KeysPosAndValuesAction::perform()
+{
+    return apply(newPosAndValues);
+}
+
+bool Automation::KeysPosAndValuesAction::undo()
+{
+    return apply(oldPosAndValues);
+}
+
+int Automation::KeysPosAndValuesAction::getSizeInUnits()
+{
+    return (int)sizeof(*this) + keysRef.size() * (int)(sizeof(WeakReference<Inspectable>) + 2 * sizeof(Point<float>));
+}
+
+bool Automation::KeysPosAndValuesAction::apply(const Array<Point<float>>& posAndValues)
+{
+    Automation* a = static_cast<Automation*>(automationRef.get());
+    if (a == nullptr || automationRef.wasObjectDeleted()) return false;
+
+    //keys that have been removed since are skipped
+    Array<AutomationKey*> keys;
+    Array<Point<float>> keysPosAndValues;
+    for (int i = 0; i < keysRef.size(); i++)
+    {
+        if (keysRef[i] == nullptr || keysRef[i].wasObjectDeleted()) continue;
+        keys.add(static_cast<AutomationKey*>(keysRef[i].get()));
+        keysPosAndValues.add(posAndValues[i]);
+    }
+
+    a->setKeysPosAndValues(keys, keysPosAndValues);
+    return true;
 }
\ No newline at end of file
@@ -27,6 +27,7 @@ public:
     Point2DParameter* valueRange;
     Point2DParameter* viewValueRange;
     bool allowKeysOutside;
+    bool isSettingKeysPosAndValues; //keys don't react to their own changes while set, see setKeysPosAndValues
 
     AutomationRecorder* recorder;
 
@@ -44,6 +45,14 @@ public:
 
     void setLength(float newLength, float stretch = false, float stickToEnd = false);
 
+    //Batch edit : keys are set, relocated only if they passed a neighbour, and their easings updated once.
+    //Changed parameters are then notified for outside listeners and the UI gets a single KEYS_UPDATED event
+    void setKeysPosAndValues(const Array<AutomationKey*>& keys, const Array<Point<float>>& posAndValues, bool addToUndo = false, const Array<Point<float>>& previousPosAndValues = Array<Point<float>>());
+    void transformKeys(const Array<AutomationKey*>& keys, const AffineTransform& transform, bool addToUndo = false); //transform is applied in (position, value) space
+
+    int getKeyIndex(AutomationKey* k); //keys must be sorted
+    int getKeyInsertIndex(float pos);
+
     Point<float> getPosAndValue();
     juce::Rectangle<float> getBounds();
 
@@ -59,10 +68,47 @@ public:
 
     void onContainerParameterChanged(Parameter* p) override;
     void onControllableStateChanged(Controllable* c) override;
+    void onControllableFeedbackUpdate(ControllableContainer* cc, Controllable* c) override;
 
     void afterLoadJSONDataInternal() override;
 
     static int compareKeys(AutomationKey* k1, AutomationKey* k2);
 
     InspectableEditor* getEditor(bool isRoot) override;
+
+    class AutomationEvent
+    {
+    public:
+        enum Type { KEYS_UPDATED };
+        AutomationEvent(Type t, Array<AutomationKey*> keys = Array<AutomationKey*>());
+
+        Type type;
+        Array<WeakReference<Inspectable>> keysRef;
+        Array<AutomationKey*> getKeys() const;
+    };
+
+    QueuedNotifier<AutomationEvent> automationNotifier;
+    typedef QueuedNotifier<AutomationEvent>::Listener AsyncListener;
+
+    void addAsyncAutomationListener(AsyncListener* newListener) { automationNotifier.addListener(newListener); }
+    void addAsyncCoalescedAutomationListener(AsyncListener* newListener) { automationNotifier.addAsyncCoalescedListener(newListener); }
+    void removeAsyncAutomationListener(AsyncListener* listener) { automationNotifier.removeListener(listener); }
+
+    class KeysPosAndValuesAction :
+        public UndoableAction
+    {
+    public:
+        KeysPosAndValuesAction(Automation* a, const Array<AutomationKey*>& keys, const Array<Point<float>>& oldPosAndValues, const Array<Point<float>>& newPosAndValues);
+
+        WeakReference<Inspectable> automationRef;
+        Array<WeakReference<Inspectable>> keysRef;
+        Array<Point<float>> oldPosAndValues;
+        Array<Point<float>> newPosAndValues;
+
+        bool perform() override;
+        bool undo() override;
+        int getSizeInUnits() override;
+
+        bool apply(const Array<Point<float>>& posAndValues);
+    };
 };
\ No newline at end of file
@@ -143,7 +143,7 @@ void AutomationKey::onContainerParameterChangedInternal(Parameter* p)
     {
         setEasing(easingType->getValueDataAsEnum<Easing::Type>());
     }
-    else if (p == position || p == value)
+    else if ((p == position || p == value) && !isInBatchEdit())
     {
         updateEasingKeys();
     }
@@ -152,7 +152,7 @@ void AutomationKey::onContainerParameterChangedInternal(Parameter* p)
 void AutomationKey::onExternalParameterValueChanged(Parameter* p)
 {
     BaseItem::onExternalParameterValueChanged(p);
-    if (nextKey != nullptr && (p == nextKey->position || p == nextKey->value))
+    if (nextKey != nullptr && (p == nextKey->position || p == nextKey->value) && !isInBatchEdit())
     {
         updateEasingKeys();
     }
@@ -196,7 +196,14 @@ void AutomationKey::updateEasingKeys()
     notifyKeyUpdated();
 }
 
+bool AutomationKey::isInBatchEdit()
+{
+    Automation* a = dynamic_cast<Automation*>(parentContainer.get());
+    return a != nullptr && a->isSettingKeysPosAndValues;
+}
+
 void AutomationKey::notifyKeyUpdated()
 {
+    if (isInBatchEdit()) return; //the automation sends a single KEYS_UPDATED for all the keys
     keyNotifier.addMessage(new AutomationKeyEvent(AutomationKeyEvent::KEY_UPDATED, this));
 }
\ No newline at end of file
@@ -49,6 +49,7 @@ public:
 
     void updateEasingKeys();
     void notifyKeyUpdated();
+    bool isInBatchEdit(); //parent automation is setting several keys at once
 
 
     String getTypeString() const override { return "Key"; }
@@ -35,6 +35,10 @@ Curve2D::Curve2D(const String &name) :
     value->setControllableFeedbackOnly(true);
 
     keySyncMode = addBoolParameter("Key Sync", "If checked, when moving 2d keys, the keys in the timeline will ajdust to keep the same timing relative to the 2D keys", false, false);
+
+    scriptObject.setMethod("getPositionForPoint", Curve2D::getPositionForPointFromScript);
+    scriptObject.setMethod("getClosestPoint", Curve2D::getClosestPointFromScript);
+    scriptObject.setMethod("setPositionFromPoint", Curve2D::setPositionFromPointFromScript);
 }
 
 Curve2D::~Curve2D()
@@ -77,6 +81,19 @@ void Curve2D::removeItemsInternal()
     if (!isCurrentlyLoadingData) updateCurve(false);
 }
 
+void Curve2D::setItemIndex(Curve2DKey* k, int newIndex)
+{
+    int index = items.indexOf(k);
+    BaseManager::setItemIndex(k, newIndex);
+    if (items.indexOf(k) != index && !isCurrentlyLoadingData) updateCurve(false); //next key links changed, full relink
+}
+
+void Curve2D::reorderItems()
+{
+    BaseManager::reorderItems();
+    if (!isCurrentlyLoadingData) updateCurve(false);
+}
+
 float Curve2D::addFromPointsAndSimplify(Array<Point<float>> sourcePoints, bool clearBeforeAdd, Array<float> pointTimes)
 {
     if (clearBeforeAdd) clear();
@@ -146,34 +163,48 @@ float Curve2D::addFromPointsAndSimplify(Array<Point<float>> sourcePoints, bool c
    return addedLength;
 }
 
-void Curve2D::updateCurve(bool relativeAutomationKeySyncMode)
+void Curve2D::updateCurve(bool relativeAutomationKeySyncMode, int fromIndex)
 {
     if (isCurrentlyLoadingData || Engine::mainEngine->isClearing) return;
 
-    Array<float> prevCurvePositions;
+    int numItems = items.size();
     float prevLength = length->floatValue();
 
-    bounds = items.size() > 0?items[0]->easing->getBounds():Rectangle<float>(0, 0, 0, 0);
+    //after a structure change, keys are relinked and everything is recomputed
+    if (keyCurvePositions.size() != numItems || keyBounds.size() != numItems) fromIndex = 0;
+    fromIndex = jlimit(0, jmax(numItems - 1, 0), fromIndex);
 
-    float curLength = 0;
-    int numItems = items.size();
-    for (int i = 0; i < numItems; i++)
+    bool keySync = numItems >= 2 && keySyncMode->boolValue() && prevLength > 0;
+    Array<float> prevCurvePositions;
+    if (keySync) for (auto& k : items) prevCurvePositions.add(k->curvePosition);
+
+    keyCurvePositions.resize(numItems);
+    keyBounds.resize(numItems);
+
+    //an edited key only changes its own easing and the one of the key before, positions after it are shifted
+    float curLength = fromIndex > 0 ? keyCurvePositions[fromIndex] : 0;
+    int lastBoundsIndex = fromIndex > 0 ? fromIndex + 1 : numItems - 1;
+
+    for (int i = fromIndex; i < numItems; i++)
     {
+        Curve2DKey* k = items[i];
+        if (fromIndex == 0 && i < numItems - 1) k->setNextKey(items[i + 1]);
 
-        if (i < numItems - 1) items[i]->setNextKey(items[i + 1]);
-        prevCurvePositions.add(items[i]->curvePosition);
-        items[i]->curvePosition = curLength;
-        if(i < numItems -1) curLength += items[i]->getLength();
+        k->curvePosition = curLength;
+        keyCurvePositions.set(i, curLength);
+        if (i < numItems - 1) curLength += k->getLength();
 
-        bounds = bounds.getUnion(items[i]->easing->getBounds());
+        if (i <= lastBoundsIndex) keyBounds.set(i, k->easing != nullptr ? k->easing->getBounds() : Rectangle<float>(k->position->getPoint(), k->position->getPoint()));
     }
 
+    bounds = numItems > 0 ? keyBounds[0] : Rectangle<float>(0, 0, 0, 0);
+    for (int i = 1; i < numItems; i++) bounds = bounds.getUnion(keyBounds.getReference(i));
+
     length->setValue(curLength);
 
     
-    if (items.size() >= 2 && keySyncMode->boolValue() && prevLength > 0 && length->floatValue() > 0)
+    if (keySync && length->floatValue() > 0)
     {
-        DBG("***");
         Automation* a = (Automation*)position->automation->automationContainer;
         for (auto& k : a->items)
         {
@@ -181,25 +212,17 @@ void Curve2D::updateCurve(bool relativeAutomationKeySyncMode)
             
             if (relativeAutomationKeySyncMode)
             {
-                Curve2DKey* prevKey = nullptr;
-                for (int j = items.size() - 2; j >= 0; j--)
-                {
-                    if (prevCurvePositions[j + 1] == prevCurvePositions[j]) continue;
-                    if (prevCurvePositions[j] <= kPrevPos)
-                    {
-                        prevKey = items[j];
-                        float relP = (kPrevPos - prevCurvePositions[j]) / (prevCurvePositions[j + 1] - prevCurvePositions[j]);
-                        float newPos = items[j]->curvePosition + relP * (items[j + 1]->curvePosition - items[j]->curvePosition);
-                        float newNormPos = newPos / length->floatValue();
-                        //DBG("kValue : " << k->value->floatValue() << ", prevLength : " << prevLength << ", length : " << length->floatValue() << ", prevCurvePos : " << prevCurvePositions[j] << ", nextCurvePos : " << prevCurvePositions[j + 1] << ", Prev Key : " << j << ", relP : " << relP << ", newPos " << newPos << " / normPos : " << newNormPos);
-                        k->value->setValue(newNormPos);
-                        break;
-                    }
-                }
+                //last segment starting before the key, zero length segments are skipped
+                int j = (int)(std::upper_bound(prevCurvePositions.begin(), prevCurvePositions.begin() + numItems - 1, kPrevPos) - prevCurvePositions.begin()) - 1;
+                while (j >= 0 && prevCurvePositions[j + 1] == prevCurvePositions[j]) j--;
+                if (j < 0) continue;
+
+                float relP = (kPrevPos - prevCurvePositions[j]) / (prevCurvePositions[j + 1] - prevCurvePositions[j]);
+                float newPos = items[j]->curvePosition + relP * (items[j + 1]->curvePosition - items[j]->curvePosition);
+                k->value->setValue(newPos / length->floatValue());
             }
             else
             {
-                //DBG("prev length : " << prevLength << ", length : " << length->floatValue() << ", kPrevPos : " << kPrevPos);// << ", prevCurvePos : " << prevCurvePositions[j] << ", Prev Key : " << j << ", relP : " << relP << ", newPos " << newPos << " / normPos : " << newNormPos);
                 k->value->setValue(kPrevPos / length->floatValue());
             }
         }
@@ -213,11 +236,27 @@ void Curve2D::computeValue()
     value->setPoint(getValueAtPosition(position->floatValue() * length->floatValue()));
 }
 
+int Curve2D::getKeyIndexForPosition(float pos) const
+{
+    if (keyCurvePositions.isEmpty()) return -1;
+    if (pos == 0) return 0;
+
+    //last key starting before or at pos
+    return (int)(std::upper_bound(keyCurvePositions.begin(), keyCurvePositions.end(), pos) - keyCurvePositions.begin()) - 1;
+}
+
 Curve2DKey* Curve2D::getKeyForPosition(float pos)
 {
     if (items.size() == 0) return nullptr;
     if (pos == 0) return items[0];
 
+    if (keyCurvePositions.size() == items.size())
+    {
+        int index = getKeyIndexForPosition(pos);
+        return index >= 0 ? items[index] : nullptr;
+    }
+
+    //index not built yet (loading)
     for (int i = items.size()-1; i >= 0; i--)
     {
         if (items[i]->curvePosition <= pos) return items[i];
@@ -244,6 +283,102 @@ Point<float> Curve2D::getValueAtPosition(float pos)
     return k->easing->getValue(normPos);
 }
 
+float Curve2D::getPositionForPoint(Point<float> p, Point<float>* closestPoint, float maxDistance)
+{
+    int numItems = items.size();
+    if (numItems == 0 || keyBounds.size() != numItems) return -1;
+
+    float bestDist = maxDistance >= 0 ? maxDistance * maxDistance : std::numeric_limits<float>::max();
+    float bestPos = -1;
+    Point<float> bestPoint;
+
+    if (numItems == 1)
+    {
+        Point<float> kp = items[0]->position->getPoint();
+        if (kp.getDistanceSquaredFrom(p) > bestDist) return -1;
+        if (closestPoint != nullptr) *closestPoint = kp;
+        return 0;
+    }
+
+    for (int i = 0; i < numItems - 1; i++)
+    {
+        //easings whose bounds are further than the best match so far can't be closer
+        const Rectangle<float>& r = keyBounds.getReference(i);
+        float dx = jmax(r.getX() - p.x, 0.0f, p.x - r.getRight());
+        float dy = jmax(r.getY() - p.y, 0.0f, p.y - r.getBottom());
+        if (dx * dx + dy * dy > bestDist) continue;
+
+        Curve2DKey* k = items[i];
+        if (k->easing == nullptr) continue;
+
+        float weight = k->easing->getClosestWeightForPos(p);
+        Point<float> kp = k->easing->getValue(weight);
+        float dist = kp.getDistanceSquaredFrom(p);
+        if (dist <= bestDist)
+        {
+            bestDist = dist;
+            bestPos = keyCurvePositions[i] + weight * k->getLength();
+            bestPoint = kp;
+        }
+    }
+
+    if (closestPoint != nullptr && bestPos >= 0) *closestPoint = bestPoint;
+    return bestPos;
+}
+
+Point<float> Curve2D::getClosestPoint(Point<float> p)
+{
+    Point<float> result;
+    getPositionForPoint(p, &result);
+    return result;
+}
+
+void Curve2D::setPositionFromPoint(Point<float> p)
+{
+    float pos = getPositionForPoint(p);
+    if (pos >= 0 && length->floatValue() > 0) position->setValue(pos / length->floatValue());
+}
+
+Point<float> Curve2D::getPointFromScriptArgs(const var::NativeFunctionArgs& a)
+{
+    if (a.numArguments >= 2) return Point<float>((float)a.arguments[0], (float)a.arguments[1]);
+    if (a.numArguments == 1 && a.arguments[0].isArray() && a.arguments[0].size() >= 2) return Point<float>((float)a.arguments[0][0], (float)a.arguments[0][1]);
+    return Point<float>();
+}
+
+var Curve2D::getPositionForPointFromScript(const var::NativeFunctionArgs& a)
+{
+    Curve2D* c = getObjectFromJS<Curve2D>(a);
+    if (c == nullptr || a.numArguments == 0) return -1;
+
+    float pos = c->getPositionForPoint(getPointFromScriptArgs(a));
+    if (pos < 0) return -1;
+    if (c->length->floatValue() == 0) return 0;
+    return pos / c->length->floatValue(); //normalized, like the position parameter
+}
+
+var Curve2D::getClosestPointFromScript(const var::NativeFunctionArgs& a)
+{
+    Curve2D* c = getObjectFromJS<Curve2D>(a);
+    if (c == nullptr || a.numArguments == 0) return var();
+
+    Point<float> p;
+    if (c->getPositionForPoint(getPointFromScriptArgs(a), &p) < 0) return var();
+
+    var result;
+    result.append(p.x);
+    result.append(p.y);
+    return result;
+}
+
+var Curve2D::setPositionFromPointFromScript(const var::NativeFunctionArgs& a)
+{
+    Curve2D* c = getObjectFromJS<Curve2D>(a);
+    if (c == nullptr || a.numArguments == 0) return var();
+    c->setPositionFromPoint(getPointFromScriptArgs(a));
+    return var();
+}
+
 void Curve2D::onContainerParameterChanged(Parameter* p)
 {
     BaseManager::onContainerParameterChanged(p);
@@ -260,7 +395,7 @@ void Curve2D::onControllableFeedbackUpdate(ControllableContainer* cc, Controllab
     
     if (Curve2DKey* k = dynamic_cast<Curve2DKey*>(cc))
     {
-        updateCurve();
+        updateCurve(true, items.indexOf(k) - 1);
     }
 }
 
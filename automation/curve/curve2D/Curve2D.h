@@ -40,15 +40,32 @@ public:
     void removeItemInternal(Curve2DKey* k) override;
     void removeItemsInternal() override;
 
+    void setItemIndex(Curve2DKey* k, int newIndex) override;
+    void reorderItems() override;
+
     virtual float addFromPointsAndSimplify(Array<Point<float>> points, bool clearBeforeAdd = false, Array<float> pointTimes = Array<float>());
 
-    void updateCurve(bool relativeAutomationKeySyncMode = true);
+    //positions of the keys on the curve and bounds of their easing, kept in sync by updateCurve
+    Array<float> keyCurvePositions;
+    Array<Rectangle<float>> keyBounds;
+
+    void updateCurve(bool relativeAutomationKeySyncMode = true, int fromIndex = 0); //keys before fromIndex are considered unchanged
     void computeValue();
 
+    int getKeyIndexForPosition(float pos) const;
     Curve2DKey* getKeyForPosition(float pos);
     Point<float> getValueAtNormalizedPosition(float pos);
     Point<float> getValueAtPosition(float pos);
 
+    float getPositionForPoint(Point<float> p, Point<float>* closestPoint = nullptr, float maxDistance = -1); //position on the curve of the closest point, -1 if none
+    Point<float> getClosestPoint(Point<float> p);
+    void setPositionFromPoint(Point<float> p);
+
+    static Point<float> getPointFromScriptArgs(const var::NativeFunctionArgs& a);
+    static var getPositionForPointFromScript(const var::NativeFunctionArgs& a);
+    static var getClosestPointFromScript(const var::NativeFunctionArgs& a);
+    static var setPositionFromPointFromScript(const var::NativeFunctionArgs& a);
+
 
     void onContainerParameterChanged(Parameter* p) override;
     void onControllableFeedbackUpdate(ControllableContainer* cc, Controllable* c) override;
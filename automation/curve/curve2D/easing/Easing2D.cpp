@@ -71,6 +71,14 @@ Point<float> LinearEasing2D::getClosestPointForPos(Point<float> pos)
 	else return Point<float>(start.x + t * dx, start.y + t * dy);
 }
 
+float LinearEasing2D::getClosestWeightForPos(Point<float> pos)
+{
+	if (start == end) return 0;
+
+	Point<float> d = end - start;
+	return jlimit(0.0f, 1.0f, ((pos.x - start.x) * d.x + (pos.y - start.y) * d.y) / (d.x * d.x + d.y * d.y));
+}
+
 Easing2DUI* LinearEasing2D::createUI()
 {
 	return new LinearEasing2DUI(this);
@@ -240,6 +248,32 @@ Point<float> CubicEasing2D::getClosestPointForPos(Point<float> pos)
 	return closestP;
 }
 
+float CubicEasing2D::getClosestWeightForPos(Point<float> pos)
+{
+	//the LUT is evenly spaced along the curve, projecting on its segments gives the weight used by getValue
+	int numPoints = uniformLUT.size();
+	if (length == 0 || numPoints < 2) return 0;
+
+	float minDist = std::numeric_limits<float>::max();
+	float result = 0;
+	for (int i = 0; i < numPoints - 1; i++)
+	{
+		Point<float> a = uniformLUT[i];
+		Point<float> d = uniformLUT[i + 1] - a;
+		float segLength = d.x * d.x + d.y * d.y;
+		float t = segLength > 0 ? jlimit(0.0f, 1.0f, ((pos.x - a.x) * d.x + (pos.y - a.y) * d.y) / segLength) : 0;
+
+		float dist = (a + d * t).getDistanceSquaredFrom(pos);
+		if (dist < minDist)
+		{
+			minDist = dist;
+			result = (i + t) / (numPoints - 1);
+		}
+	}
+
+	return result;
+}
+
 void CubicEasing2D::onContainerParameterChanged(Parameter* p)
 {
 	updateBezier();
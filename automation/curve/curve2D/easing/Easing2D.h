@@ -35,6 +35,7 @@ public:
 	virtual void updateLength() = 0;
 	virtual Rectangle<float> getBounds(bool includeHandles = false) = 0;
 	virtual Point<float> getClosestPointForPos(Point<float> pos) = 0;
+	virtual float getClosestWeightForPos(Point<float> pos) = 0; //weight to use with getValue
 	virtual Easing2DUI* createUI() = 0; //must be overriden
 
 private:
@@ -54,6 +55,7 @@ public:
 	void updateLength() override;
 	Rectangle<float> getBounds(bool includeHandles) override;
 	Point<float> getClosestPointForPos(Point<float> pos);
+	float getClosestWeightForPos(Point<float> pos) override;
 
 	Easing2DUI* createUI() override;
 };
@@ -83,6 +85,7 @@ public:
 	
 	Rectangle<float> getBounds(bool includeHandles) override;
 	Point<float> getClosestPointForPos(Point<float> pos);
+	float getClosestWeightForPos(Point<float> pos) override;
 
 	void onContainerParameterChanged(Parameter* p) override;
 
@@ -14,7 +14,8 @@
 
 Curve2DUI::Curve2DUI(Curve2D* manager) :
     BaseManagerViewUI(manager->niceName, manager),
-    paintingMode(false)
+    paintingMode(false),
+    positionDragMode(false)
 {
     useCheckersAsUnits = true;
     minZoom = .1f;
@@ -158,6 +159,11 @@ void Curve2DUI::mouseDown(const MouseEvent& e)
         paintingPoints.clear();
         paintingPoints.add(getViewPos(e.getPosition()));
     }
+    else if (e.eventComponent == this && e.mods.isLeftButtonDown() && e.mods.isAltDown() && manager->position->controlMode == Parameter::MANUAL)
+    {
+        positionDragMode = true;
+        manager->setPositionFromPoint(getViewMousePosition());
+    }
     else
     {
         BaseManagerViewUI::mouseDown(e);
@@ -172,7 +178,11 @@ void Curve2DUI::mouseDrag(const MouseEvent& e)
     }
     else if (e.eventComponent == this)
     {
-        if (paintingMode)
+        if (positionDragMode)
+        {
+            manager->setPositionFromPoint(getViewMousePosition());
+        }
+        else if (paintingMode)
         {
             paintingPoints.add(getViewPos(e.getPosition()));
             repaint();
@@ -194,6 +204,10 @@ void Curve2DUI::mouseUp(const MouseEvent& e)
         paintingPoints.clear();
         repaint();
     }
+    else if (positionDragMode)
+    {
+        positionDragMode = false;
+    }
     else
     {
         BaseManagerViewUI::mouseUp(e);
@@ -207,7 +221,20 @@ void Curve2DUI::mouseDoubleClick(const MouseEvent& e)
         Point<float> p = getViewMousePosition();
         Curve2DKey* k = manager->createItem();
         k->position->setPoint(p);
-        manager->addItem(k);
+
+        //close enough to the curve, the key is inserted in the segment under the mouse instead of at the end
+        Point<float> closest;
+        float pos = manager->getPositionForPoint(p, &closest);
+        if (pos >= 0 && getPosInView(closest).getDistanceFrom(e.getEventRelativeTo(this).getPosition()) < 10)
+        {
+            var params(new DynamicObject());
+            params.getDynamicObject()->setProperty("index", manager->getKeyIndexForPosition(pos) + 1);
+            manager->addItem(k, params);
+        }
+        else
+        {
+            manager->addItem(k);
+        }
     }
     else if (Easing2DUI* eui = dynamic_cast<Easing2DUI*>(e.eventComponent))
     {
@@ -24,6 +24,8 @@ public:
     bool paintingMode;
     Array<Point<float>> paintingPoints;
 
+    bool positionDragMode; //alt + drag on the view moves the curve position to the closest point
+
     void paintOverChildren(Graphics& g) override;
 
     void updateViewUIPosition(Curve2DKeyUI * ui) override;
@@ -92,8 +92,8 @@ void ParameterAutomation::onControllableFeedbackUpdateInternal(ControllableConta
 	}
 	else if (c == valueParamRef)
 	{
-		if (valueIsNormalized) parameter->setNormalizedValue(valueParamRef->value);
-		else parameter->setValue(valueParamRef->value);
+		if (valueIsNormalized) parameter->setNormalizedValue(valueParamRef->getValue());
+		else parameter->setValue(valueParamRef->getValue());
 	}
 }
 
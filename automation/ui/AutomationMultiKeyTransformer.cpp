@@ -48,6 +48,9 @@ void AutomationMultiKeyTransformer::updateBoundsFromKeys()
 
 void AutomationMultiKeyTransformer::updateKeysFromBounds()
 {
+	Array<AutomationKey *> keys;
+	Array<Point<float>> targets;
+
 	int numKeys = keysUI.size();
 	for (int i = 0; i < numKeys; i++)
 	{
@@ -55,9 +58,11 @@ void AutomationMultiKeyTransformer::updateKeysFromBounds()
 		Point<int> timelinePos = aui->getLocalPoint(this, localPos);
 		float targetPos = aui->getPosForX(timelinePos.x);
 		float targetVal = 1 - (timelinePos.y*1.f / aui->getHeight());
-		keysUI[i]->item->position->setValue(targetPos);
-		keysUI[i]->item->value->setValue(targetVal);
+		keys.add(keysUI[i]->item);
+		targets.add(Point<float>(targetPos, targetVal));
 	}
+
+	aui->manager->setKeysPosAndValues(keys, targets);
 }
 
 void AutomationMultiKeyTransformer::parentHierarchyChanged()
@@ -124,12 +129,14 @@ void AutomationMultiKeyTransformer::mouseUp(const MouseEvent & e)
 {
 	if (e.getOffsetFromDragStart().getDistanceFromOrigin() == 0) return;
 
-	Array<UndoableAction *> actions;
-	int numKeys = keysUI.size();
-	for (int i = 0; i < numKeys; i++)
+	//keys are already in place, this only registers a single undo action from the positions at mouse down
+	Array<AutomationKey *> keys;
+	Array<Point<float>> posAndValues;
+	for (auto &k : keysUI)
 	{
-		actions.add(keysUI[i]->item->position->setUndoableValue(keysTimesAndValuesPositions[i].x, keysUI[i]->item->position->floatValue(), true));
-		actions.add(keysUI[i]->item->value->setUndoableValue(keysTimesAndValuesPositions[i].y, keysUI[i]->item->value->floatValue(), true));
+		keys.add(k->item);
+		posAndValues.add(k->item->getPosAndValue());
 	}
-	UndoMaster::getInstance()->performActions("Move " + String(numKeys) + " keys", actions);
+
+	aui->manager->setKeysPosAndValues(keys, posAndValues, true, keysTimesAndValuesPositions);
 }
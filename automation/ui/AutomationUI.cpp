@@ -12,12 +12,19 @@ AutomationUI::AutomationUI(Automation* manager) :
     BaseManagerUI(manager->niceName, manager, false),
     paintingMode(false),
     previewMode(false),
-    showNumberLines(true)
+    showNumberLines(true),
+    envelopeResolution(4096),
+    envelopePathIsDirty(true),
+    focusKeyThreshold(64),
+    focusRadius(80),
+    focusPosition(0),
+    isFocusMode(false)
 {
     resizeOnChildBoundsChanged = false;
 
     animateItemOnAdd = false;
     manager->addAsyncContainerListener(this);
+    manager->addAsyncAutomationListener(this);
     
     transparentBG = true;
 
@@ -27,7 +34,11 @@ AutomationUI::AutomationUI(Automation* manager) :
 
 AutomationUI::~AutomationUI()
 {
-    if (!inspectable.wasObjectDeleted()) manager->removeAsyncContainerListener(this);
+    if (!inspectable.wasObjectDeleted())
+    {
+        manager->removeAsyncContainerListener(this);
+        manager->removeAsyncAutomationListener(this);
+    }
 
     for (auto& ui : itemsUI)
     {
@@ -45,16 +56,9 @@ void AutomationUI::paint(Graphics& g)
 
     if (previewMode)
     {
-        Path p;
-        p.startNewSubPath(Point<float>(0, getYForValue(manager->getValueAtPosition(getPosForX(0)))));
-        for (int i = 1; i < getWidth(); i+=2)
-        {
-            p.lineTo(Point<float>(i, getYForValue(manager->getValueAtPosition(getPosForX(i)))));
-        }
-
-
+        updateEnvelopePath();
         g.setColour(NORMAL_COLOR);
-        g.strokePath(p, PathStrokeType(1));
+        g.strokePath(envelopePath, PathStrokeType(1));
         return;
     }
 
@@ -83,6 +87,26 @@ void AutomationUI::paint(Graphics& g)
             g.drawDashedLine(Line<int>(p, Point<int>(getWidth(), p.y)).toFloat(), dashLengths, 2);
         }
     }
+
+    if (isFocusMode)
+    {
+        //keys without interactive ui are drawn in a single pass
+        updateEnvelopePath();
+        g.setColour(NORMAL_COLOR);
+        g.strokePath(envelopePath, PathStrokeType(1));
+
+        int firstIndex = getKeyIndexForPosition(viewPosRange.x);
+        int lastIndex = jmin(getKeyIndexForPosition(viewPosRange.y) + 1, manager->items.size() - 1);
+        if ((lastIndex - firstIndex) * 4 < getWidth())
+        {
+            g.setColour(NORMAL_COLOR.darker());
+            for (int i = firstIndex; i <= lastIndex; i++)
+            {
+                if (itemsUI[i] != nullptr && itemsUI[i]->isVisible()) continue;
+                g.fillEllipse(Rectangle<int>(0, 0, 4, 4).withCentre(getPosInView(manager->items[i]->getPosAndValue())).toFloat());
+            }
+        }
+    }
 }
 
 void AutomationUI::drawLinesBackground(Graphics& g)
@@ -300,6 +324,232 @@ void AutomationUI::setPreviewMode(bool value)
     repaint();
 }
 
+void AutomationUI::invalidateEnvelope()
+{
+    envelopeLevels.clear();
+    envelopeDirtyBuckets = Range<int>();
+    envelopePathIsDirty = true;
+}
+
+void AutomationUI::invalidateEnvelope(float startPos, float endPos)
+{
+    envelopePathIsDirty = true;
+
+    float l = manager->length->floatValue();
+    if (envelopeLevels.isEmpty() || l <= 0) return;
+
+    float bucketLength = l / envelopeResolution;
+    Range<int> r(jlimit(0, envelopeResolution, (int)std::floor(startPos / bucketLength)), jlimit(0, envelopeResolution, (int)std::ceil(endPos / bucketLength) + 1));
+    envelopeDirtyBuckets = envelopeDirtyBuckets.isEmpty() ? r : envelopeDirtyBuckets.getUnionWith(r);
+}
+
+void AutomationUI::invalidateEnvelopeForKey(AutomationKey* k)
+{
+    //invalidate where the key was last time as well, in case it moved
+    if (keyEnvelopeRanges.contains(k))
+    {
+        Range<float> oldRange = keyEnvelopeRanges[k];
+        invalidateEnvelope(oldRange.getStart(), oldRange.getEnd());
+    }
+
+    int index = manager->items.indexOf(k);
+    if (index == -1)
+    {
+        keyEnvelopeRanges.remove(k);
+        return;
+    }
+
+    float pos = k->position->floatValue();
+    float startPos = index > 0 ? manager->items[index - 1]->position->floatValue() : 0;
+    float endPos = k->nextKey != nullptr ? k->nextKey->position->floatValue() : manager->length->floatValue();
+
+    Range<float> r(jmin(startPos, pos), jmax(endPos, pos));
+    keyEnvelopeRanges.set(k, r);
+    invalidateEnvelope(r.getStart(), r.getEnd());
+}
+
+void AutomationUI::updateEnvelope()
+{
+    float l = manager->length->floatValue();
+    if (l <= 0 || manager->items.isEmpty())
+    {
+        envelopeLevels.clear();
+        envelopeDirtyBuckets = Range<int>();
+        return;
+    }
+
+    if (envelopeLevels.isEmpty())
+    {
+        //resolution is a power of 2 so each level is exactly half of the previous one
+        for (int numBuckets = envelopeResolution; numBuckets >= 1; numBuckets /= 2)
+        {
+            envelopeLevels.add(Array<Range<float>>());
+            envelopeLevels.getReference(envelopeLevels.size() - 1).resize(numBuckets);
+        }
+
+        envelopeDirtyBuckets = Range<int>(0, envelopeResolution);
+    }
+
+    if (envelopeDirtyBuckets.isEmpty()) return;
+
+    float bucketLength = l / envelopeResolution;
+    Array<Range<float>>& baseLevel = envelopeLevels.getReference(0);
+
+    int keyIndex = getKeyIndexForPosition(envelopeDirtyBuckets.getStart() * bucketLength);
+    for (int b = envelopeDirtyBuckets.getStart(); b < envelopeDirtyBuckets.getEnd(); b++)
+    {
+        float startPos = b * bucketLength;
+        Range<float> r = Range<float>::emptyRange(getEnvelopeValueAt(keyIndex, startPos));
+        int firstKeyInside = keyIndex + 1;
+        r = r.getUnionWith(getEnvelopeValueAt(keyIndex, startPos + bucketLength * .5f));
+        r = r.getUnionWith(getEnvelopeValueAt(keyIndex, startPos + bucketLength));
+
+        for (int i = firstKeyInside; i <= keyIndex; i++)
+        {
+            r = r.getUnionWith(manager->items[i]->value->floatValue());
+
+            //segments fully inside the bucket can use their exact bounds
+            if (i < keyIndex && manager->items[i]->easing != nullptr)
+            {
+                Rectangle<float> eb = manager->items[i]->easing->getBounds();
+                r = r.getUnionWith(Range<float>(eb.getY(), eb.getBottom()));
+            }
+        }
+
+        baseLevel.set(b, r);
+    }
+
+    Range<int> dirty = envelopeDirtyBuckets;
+    for (int level = 1; level < envelopeLevels.size(); level++)
+    {
+        Array<Range<float>>& prevLevel = envelopeLevels.getReference(level - 1);
+        Array<Range<float>>& curLevel = envelopeLevels.getReference(level);
+        dirty = Range<int>(dirty.getStart() / 2, jmin((dirty.getEnd() + 1) / 2, curLevel.size()));
+        for (int b = dirty.getStart(); b < dirty.getEnd(); b++) curLevel.set(b, prevLevel[b * 2].getUnionWith(prevLevel[b * 2 + 1]));
+    }
+
+    envelopeDirtyBuckets = Range<int>();
+}
+
+Range<float> AutomationUI::getEnvelopeRange(float startPos, float endPos)
+{
+    if (manager->items.isEmpty()) return Range<float>();
+
+    int keyIndex = getKeyIndexForPosition(startPos);
+    Range<float> r = Range<float>::emptyRange(getEnvelopeValueAt(keyIndex, startPos));
+
+    float l = manager->length->floatValue();
+    float bucketLength = l / envelopeResolution;
+
+    //zoomed further than the envelope resolution (or no envelope), evaluate the curve directly
+    if (envelopeLevels.isEmpty() || l <= 0 || endPos - startPos < bucketLength)
+    {
+        int firstKeyInside = keyIndex + 1;
+        r = r.getUnionWith(getEnvelopeValueAt(keyIndex, endPos));
+        for (int i = firstKeyInside; i <= keyIndex; i++) r = r.getUnionWith(manager->items[i]->value->floatValue());
+        return r;
+    }
+
+    r = r.getUnionWith(getEnvelopeValueAt(keyIndex, endPos));
+    if (endPos <= 0 || startPos >= l) return r;
+
+    int level = jlimit(0, envelopeLevels.size() - 1, (int)std::floor(std::log2((endPos - startPos) / bucketLength)));
+    float levelBucketLength = bucketLength * (1 << level);
+    const Array<Range<float>>& buckets = envelopeLevels.getReference(level);
+
+    int b0 = jlimit(0, buckets.size() - 1, (int)std::floor(jmax(startPos, 0.f) / levelBucketLength));
+    int b1 = jlimit(b0, buckets.size() - 1, (int)std::ceil(jmin(endPos, l) / levelBucketLength) - 1);
+    for (int b = b0; b <= b1; b++) r = r.getUnionWith(buckets[b]);
+
+    return r;
+}
+
+float AutomationUI::getEnvelopeValueAt(int& keyIndex, float pos)
+{
+    //keyIndex only moves forward, so consecutive calls with increasing positions don't search again
+    if (manager->items.isEmpty()) return 0;
+
+    keyIndex = jlimit(0, manager->items.size() - 1, keyIndex);
+    while (keyIndex < manager->items.size() - 1 && manager->items[keyIndex + 1]->position->floatValue() <= pos) keyIndex++;
+
+    AutomationKey* k = manager->items[keyIndex];
+    float kPos = k->position->floatValue();
+    if (pos <= kPos || k->nextKey == nullptr || k->easing == nullptr || k->getLength() <= 0) return k->value->floatValue();
+    return k->getValueAt(pos - kPos);
+}
+
+void AutomationUI::updateEnvelopePath()
+{
+    Rectangle<float> viewBounds(viewPosRange.x, manager->viewValueRange->x, viewLength, manager->viewValueRange->y - manager->viewValueRange->x);
+    if (!envelopePathIsDirty && envelopePathViewBounds == viewBounds && envelopePathSize == getLocalBounds()) return;
+
+    envelopePathIsDirty = false;
+    envelopePathViewBounds = viewBounds;
+    envelopePathSize = getLocalBounds();
+    envelopePath.clear();
+
+    if (getWidth() == 0 || viewLength <= 0) return;
+
+    updateEnvelope();
+
+    float prevY = 0;
+    for (int i = 0; i < getWidth(); i++)
+    {
+        Range<float> r = getEnvelopeRange(getPosForX(i), getPosForX(i + 1));
+        float yMin = getYForValue(r.getEnd());
+        float yMax = getYForValue(r.getStart());
+
+        //draw the column from the end closest to the previous one to avoid zigzags
+        float y1 = std::abs(prevY - yMin) < std::abs(prevY - yMax) ? yMin : yMax;
+        float y2 = y1 == yMin ? yMax : yMin;
+
+        if (i == 0) envelopePath.startNewSubPath(i, y1);
+        else envelopePath.lineTo(i, y1);
+        if (y2 != y1) envelopePath.lineTo(i, y2);
+
+        prevY = y2;
+    }
+}
+
+int AutomationUI::getKeyIndexForPosition(float pos)
+{
+    //binary search for the last key before pos
+    int start = 0;
+    int end = manager->items.size();
+    while (start < end)
+    {
+        int mid = (start + end) / 2;
+        if (manager->items[mid]->position->floatValue() <= pos) start = mid + 1;
+        else end = mid;
+    }
+
+    return jmax(start - 1, 0);
+}
+
+bool AutomationUI::isKeyInFocus(int index)
+{
+    if (focusKeyRange.contains(index)) return true;
+
+    for (int i = jmax(index - 1, 0); i <= jmin(index + 1, manager->items.size() - 1); i++)
+    {
+        if (manager->items[i]->isThisOrChildSelected()) return true;
+    }
+
+    return false;
+}
+
+void AutomationUI::setFocusPosition(float pos)
+{
+    focusPosition = pos;
+
+    float radius = getPosForX(focusRadius, true);
+    Range<int> r(getKeyIndexForPosition(focusPosition - radius), getKeyIndexForPosition(focusPosition + radius) + 1);
+    if (r == focusKeyRange) return;
+
+    updateItemsVisibility();
+    repaint();
+}
+
 void AutomationUI::setViewRange(float start, float end)
 {
     viewPosRange.setXY(start, end);
@@ -314,12 +564,22 @@ void AutomationUI::updateItemsVisibility()
     if (itemsUI.size() == 0) return;
     if (previewMode) return;
 
-    int firstIndex = jmax(manager->items.indexOf(manager->getKeyForPosition(viewPosRange.x)), 0);
-    int lastIndex = jmax(manager->items.indexOf(manager->getKeyForPosition(viewPosRange.y))+1, firstIndex);
-   
-    for (int i=0;i<itemsUI.size();i++)
+    int firstIndex = getKeyIndexForPosition(viewPosRange.x);
+    int lastIndex = getKeyIndexForPosition(viewPosRange.y) + 1;
+
+    isFocusMode = lastIndex - firstIndex > focusKeyThreshold;
+    if (isFocusMode)
+    {
+        float radius = getPosForX(focusRadius, true);
+        focusKeyRange = Range<int>(getKeyIndexForPosition(focusPosition - radius), getKeyIndexForPosition(focusPosition + radius) + 1);
+    }
+
+    for (int i = 0; i < itemsUI.size(); i++)
     {
-        itemsUI[i]->setVisible(i >= firstIndex && i <= lastIndex);
+        bool v = i >= firstIndex && i <= lastIndex && (!isFocusMode || isKeyInFocus(i));
+        if (itemsUI[i]->isVisible() == v) continue;
+        itemsUI[i]->setVisible(v);
+        if (v) placeKeyUI(itemsUI[i]);
     }
 }
 
@@ -328,6 +588,7 @@ void AutomationUI::addItemUIInternal(AutomationKeyUI* ui)
     ui->addMouseListener(this, true);
     ui->item->addAsyncKeyListener(this);
     ui->addKeyUIListener(this);
+    invalidateEnvelopeForKey(ui->item);
 }
 
 void AutomationUI::removeItemUIInternal(AutomationKeyUI* ui)
@@ -338,6 +599,13 @@ void AutomationUI::removeItemUIInternal(AutomationKeyUI* ui)
         ui->item->removeAsyncKeyListener(this);
         ui->removeKeyUIListener(this);
     }
+
+    if (keyEnvelopeRanges.contains(ui->item))
+    {
+        Range<float> r = keyEnvelopeRanges[ui->item];
+        invalidateEnvelope(r.getStart(), r.getEnd());
+        keyEnvelopeRanges.remove(ui->item);
+    }
 }
 
 void AutomationUI::mouseDown(const MouseEvent& e)
@@ -361,6 +629,12 @@ void AutomationUI::mouseDown(const MouseEvent& e)
     }
 }
 
+void AutomationUI::mouseMove(const MouseEvent& e)
+{
+    if (!isFocusMode || previewMode) return;
+    setFocusPosition(getPosForX(e.getEventRelativeTo(this).getPosition().x));
+}
+
 void AutomationUI::mouseDrag(const MouseEvent& e)
 {    
     if (AutomationKeyHandle* handle = dynamic_cast<AutomationKeyHandle*>(e.eventComponent))
@@ -524,18 +798,38 @@ void AutomationUI::newMessage(const AutomationKey::AutomationKeyEvent& e)
     {
     case AutomationKey::AutomationKeyEvent::KEY_UPDATED:
     {
+        invalidateEnvelopeForKey(e.key);
         placeKeyUI(getUIForItem(e.key));
+        if (previewMode || isFocusMode) repaint();
     }
     break;
 
     case AutomationKey::AutomationKeyEvent::SELECTION_CHANGED:
     {
+        if (isFocusMode) updateItemsVisibility();
         updateHandlesForUI(getUIForItem(e.key), true);
     }
     break;
     }
 }
 
+void AutomationUI::newMessage(const Automation::AutomationEvent& e)
+{
+    switch (e.type)
+    {
+    case Automation::AutomationEvent::KEYS_UPDATED:
+    {
+        for (auto& k : e.getKeys())
+        {
+            invalidateEnvelopeForKey(k);
+            placeKeyUI(getUIForItem(k));
+        }
+        repaint();
+    }
+    break;
+    }
+}
+
 void AutomationUI::newMessage(const ContainerAsyncEvent& e)
 {
     if (e.type == ContainerAsyncEvent::ControllableFeedbackUpdate)
@@ -544,6 +838,11 @@ void AutomationUI::newMessage(const ContainerAsyncEvent& e)
         {
             repaint();
         }
+        else if (e.targetControllable == manager->length)
+        {
+            invalidateEnvelope();
+            repaint();
+        }
         else if (e.targetControllable->parentContainer == manager->items[0] || e.targetControllable->parentContainer == manager->items[manager->items.size() - 1])
         {
             repaint();
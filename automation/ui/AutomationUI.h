@@ -13,6 +13,7 @@
 class AutomationUI :
     public BaseManagerUI<Automation, AutomationKey, AutomationKeyUI>,
     public AutomationKey::AsyncListener,
+    public Automation::AsyncListener,
     public AutomationKeyUI::KeyUIListener,
     public ContainerAsyncListener
 {
@@ -32,6 +33,24 @@ public:
 
     Point<float> viewValueRangeAtMouseDown;
 
+    //envelope cache, min/max of the curve per bucket, each level merges 2 buckets of the previous one
+    int envelopeResolution;
+    Array<Array<Range<float>>> envelopeLevels;
+    Range<int> envelopeDirtyBuckets;
+    HashMap<AutomationKey*, Range<float>> keyEnvelopeRanges;
+
+    Path envelopePath;
+    bool envelopePathIsDirty;
+    Rectangle<float> envelopePathViewBounds;
+    Rectangle<int> envelopePathSize;
+
+    //when there are too many keys in view, only keys near the mouse or the selection get an interactive ui
+    int focusKeyThreshold;
+    int focusRadius;
+    float focusPosition;
+    bool isFocusMode;
+    Range<int> focusKeyRange;
+
     void paint(Graphics& g) override;
     void drawLinesBackground(Graphics& g);
 
@@ -43,6 +62,18 @@ public:
 
     void setPreviewMode(bool value);
 
+    void invalidateEnvelope();
+    void invalidateEnvelope(float startPos, float endPos);
+    void invalidateEnvelopeForKey(AutomationKey* k);
+    void updateEnvelope();
+    Range<float> getEnvelopeRange(float startPos, float endPos);
+    float getEnvelopeValueAt(int& keyIndex, float pos);
+    void updateEnvelopePath();
+
+    int getKeyIndexForPosition(float pos);
+    bool isKeyInFocus(int index);
+    void setFocusPosition(float pos);
+
     void setViewRange(float start, float end);
     void updateItemsVisibility() override;
 
@@ -50,6 +81,7 @@ public:
     void removeItemUIInternal(AutomationKeyUI* ui) override;
 
     void mouseDown(const MouseEvent& e) override;
+    void mouseMove(const MouseEvent& e) override;
     void mouseDrag(const MouseEvent& e) override;
     void mouseUp(const MouseEvent& e) override;
     void mouseDoubleClick(const MouseEvent& e) override;
@@ -67,6 +99,7 @@ public:
     int getYForValue(float x, bool relative = false);
 
     void newMessage(const AutomationKey::AutomationKeyEvent& e) override;
+    void newMessage(const Automation::AutomationEvent& e) override;
     void newMessage(const ContainerAsyncEvent& e) override;
 
     void keyEasingHandleMoved(AutomationKeyUI* ui, bool syncOtherHandle, bool isFirst) override;
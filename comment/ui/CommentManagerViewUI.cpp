@@ -15,6 +15,7 @@ CommentManagerViewUI::CommentManagerViewUI(CommentManager * manager) :
 	autoFilterHitTestOnItems = true;
 	validateHitTestOnNoItem = false;
 	transparentBG = true;
+	setUseSpatialIndex(true);
 }
 
 CommentManagerViewUI::~CommentManagerViewUI()
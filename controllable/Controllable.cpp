@@ -25,9 +25,10 @@ const Array<String> Controllable::typeNames = {
 Controllable::Controllable(const Type &type, const String & niceName, const String &description, bool enabled) :
 	ScriptTarget("", this, "Controllable"),
 	type(type),
-	description(description),
+	description(getPooledString(description)),
 	customData(var()),
 	saveCustomData(false),
+	enabled(true),
 	canBeDisabledByUser(false),
 	descriptionIsEditable(false),
 	hasCustomShortName(false),
@@ -41,6 +42,8 @@ Controllable::Controllable(const Type &type, const String & niceName, const Stri
 	isCustomizableByUser(false),
 	isRemovableByUser(false),
 	replaceSlashesInShortName(true),
+	cachedControlAddressGeneration(0),
+	controlAddressGeneration(0),
 	parentContainer(nullptr),
 	queuedNotifier(10)
 {
@@ -82,7 +85,8 @@ UndoableAction * Controllable::setUndoableNiceName(const String & newNiceName, b
 void Controllable::setNiceName(const String & _niceName) {
 	if (niceName == _niceName) return;
 
-	this->niceName = _niceName;
+	this->niceName = getPooledString(_niceName);
+	++ControllableContainer::structureGeneration; //menus show nice names
 	if (!hasCustomShortName) setAutoShortName();
 	else
 	{
@@ -93,7 +97,7 @@ void Controllable::setNiceName(const String & _niceName) {
 
 void Controllable::setCustomShortName(const String & _shortName)
 {
-	this->shortName = _shortName;
+	this->shortName = getPooledString(_shortName);
 	hasCustomShortName = true;
 	scriptTargetName = shortName;
 	updateControlAddress();
@@ -104,7 +108,7 @@ void Controllable::setCustomShortName(const String & _shortName)
 
 void Controllable::setAutoShortName() {
 	hasCustomShortName = false;
-	shortName = StringUtil::toShortName(niceName, replaceSlashesInShortName);
+	shortName = getPooledString(StringUtil::toShortName(niceName, replaceSlashesInShortName));
 	if (shortName.isEmpty()) shortName = "***";
 	scriptTargetName = shortName;
 	updateControlAddress();
@@ -113,6 +117,13 @@ void Controllable::setAutoShortName() {
 }
 
 
+void Controllable::setControllableExposed(bool value)
+{
+	if (isControllableExposed == value) return;
+	isControllableExposed = value;
+	++ControllableContainer::structureGeneration;
+}
+
 void Controllable::setEnabled(bool value, bool silentSet, bool force)
 {
 	if (!force && value == enabled) return;
@@ -141,7 +152,14 @@ void Controllable::setParentContainer(ControllableContainer * container)
 
 void Controllable::updateControlAddress()
 {
-	this->controlAddress = getControlAddress();
+	{
+		//rebuilt on the next getControlAddress, container generations start at 1
+		GenericScopedLock<SpinLock> lock(controlAddressLock);
+		controlAddressGeneration++;
+		cachedControlAddressGeneration = 0;
+	}
+
+	++ControllableContainer::structureGeneration;
 	this->liveScriptObjectIsDirty = true;
 	listeners.call(&Listener::controllableControlAddressChanged, this);
 	queuedNotifier.addMessage(new ControllableEvent(ControllableEvent::CONTROLADDRESS_CHANGED, this));
@@ -207,7 +225,36 @@ void Controllable::loadJSONData(var data)
 
 String Controllable::getControlAddress(ControllableContainer * relativeTo)
 {
-	return parentContainer->getControlAddress(relativeTo) + "/" + shortName;
+	ControllableContainer* pc = parentContainer.get();
+	if (pc == nullptr) return "/" + shortName;
+	if (relativeTo != nullptr) return pc->getControlAddress(relativeTo) + "/" + shortName;
+
+	uint32 parentGeneration = pc->addressGeneration.get();
+	uint32 generation;
+	{
+		GenericScopedLock<SpinLock> lock(controlAddressLock);
+		if (cachedControlAddressGeneration == parentGeneration) return cachedControlAddress;
+		generation = controlAddressGeneration;
+	}
+
+	//if the parent changes meanwhile its generation won't match anymore, if this one is renamed meanwhile the address is not cached
+	String address = pc->getControlAddress() + "/" + shortName;
+
+	GenericScopedLock<SpinLock> lock(controlAddressLock);
+	if (controlAddressGeneration == generation)
+	{
+		cachedControlAddress = address;
+		cachedControlAddressGeneration = parentGeneration;
+	}
+	return address;
+}
+
+bool Controllable::usePooledStrings = true;
+
+String Controllable::getPooledString(const String& s)
+{
+	if (!usePooledStrings) return s;
+	return StringPool::getGlobalPool().getPooledString(s);
 }
 
 
@@ -412,7 +459,7 @@ var Controllable::getScriptControlAddressFromScript(const juce::var::NativeFunct
 {
 	Controllable* c = getObjectFromJS<Controllable>(a);
 	if (c == nullptr) return var();
-	return "root" + c->controlAddress.replaceCharacter('/', '.');
+	return "root" + c->getControlAddress().replaceCharacter('/', '.');
 }
 
 String Controllable::getScriptTargetString()
@@ -46,8 +46,6 @@ public:
 	bool hideInOutliner;
 	bool includeInScriptObject;
 
-	String controlAddress;
-
 	//save & load
 	bool isSavable;
 	bool saveValueOnly;
@@ -59,6 +57,12 @@ public:
 
 	bool replaceSlashesInShortName;
 
+	//control address is derived from the parent chain on demand, and cached until the parent's address generation changes
+	SpinLock controlAddressLock;
+	String cachedControlAddress;
+	uint32 cachedControlAddressGeneration; //parent's generation the cached address was built with
+	uint32 controlAddressGeneration; //bumped when this one is renamed or moved
+
 	WeakReference<ControllableContainer> parentContainer;
 
 	UndoableAction * setUndoableNiceName(const String &_niceName, bool onlyReturnAction = false);
@@ -67,6 +71,7 @@ public:
 	void setAutoShortName();
 
 	virtual void setEnabled(bool value, bool silentSet = false, bool force = false);
+	void setControllableExposed(bool value); //use this instead of setting isControllableExposed after creation, so cached chooser menus are rebuilt
 	virtual void setControllableFeedbackOnly(bool value);
 
 	void setParentContainer(ControllableContainer * container);
@@ -89,6 +94,9 @@ public:
 
 	String getControlAddress(ControllableContainer * relativeTo = nullptr);
 
+	static String getPooledString(const String& s); //for strings shared by many instances, like descriptions
+	static bool usePooledStrings; //only disabled to measure the pool's gain
+
 	// used for generating editor
 	virtual ControllableUI * createDefaultUI(Controllable * targetControllable = nullptr) = 0;
 
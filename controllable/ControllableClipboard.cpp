@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+
+    ControllableClipboard.cpp
+    Created: 18 Oct 2026 9:28:37pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+juce_ImplementSingleton(ControllableClipboard)
+
+ControllableClipboard::ControllableClipboard()
+{
+}
+
+ControllableClipboard::~ControllableClipboard()
+{
+}
+
+void ControllableClipboard::copy(var _data, ControllableContainer* source)
+{
+	data = _data;
+	text = JSON::toString(data);
+	SystemClipboard::copyTextToClipboard(text);
+
+	sourceContainer = source;
+	sourceSnapshot.reset(source != nullptr ? source->createSnapshot() : nullptr);
+}
+
+var ControllableClipboard::getData()
+{
+	if (isFromThisProcess()) return data;
+	return JSON::parse(SystemClipboard::getTextFromClipboard());
+}
+
+bool ControllableClipboard::isFromThisProcess()
+{
+	if (data.isVoid()) return false;
+
+	//something else may have been copied since, here or in another app
+	String s = SystemClipboard::getTextFromClipboard();
+	return s.length() == text.length() && s == text;
+}
+
+bool ControllableClipboard::canPasteValuesTo(ControllableContainer* target)
+{
+	if (target == nullptr || sourceContainer == nullptr || sourceContainer.wasObjectDeleted() || sourceSnapshot == nullptr) return false;
+	return isFromThisProcess() && target->hasSameStructureAs(sourceContainer.get());
+}
+
+bool ControllableClipboard::pasteValuesTo(ControllableContainer* target)
+{
+	if (!canPasteValuesTo(target)) return false;
+
+	target->copyValuesFrom(sourceContainer.get(), sourceSnapshot.get());
+	return true;
+}
@@ -0,0 +1,36 @@
+/*
+  ==============================================================================
+
+    ControllableClipboard.h
+    Created: 18 Oct 2026 9:28:37pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//In-process clipboard : the JSON text is put on the system clipboard, and the copied var tree is kept
+//so pasting in the app doesn't parse it back as long as the system clipboard still holds that text.
+class ControllableClipboard
+{
+public:
+	juce_DeclareSingleton(ControllableClipboard, true);
+
+	ControllableClipboard();
+	~ControllableClipboard();
+
+	var data;
+	String text;
+
+	//for containers, values are also kept natively so "Paste values" can set them without going through JSON, if the structure matches
+	WeakReference<ControllableContainer> sourceContainer;
+	std::unique_ptr<ParameterSnapshot> sourceSnapshot;
+
+	void copy(var data, ControllableContainer* source = nullptr);
+	var getData(); //don't modify the returned data, it is shared with the clipboard
+	bool isFromThisProcess();
+
+	bool canPasteValuesTo(ControllableContainer* target);
+	bool pasteValuesTo(ControllableContainer* target); //only sets the values, ranges, control modes and flags are not pasted
+};
@@ -9,6 +9,7 @@
  */
 
 ControllableComparator ControllableContainer::comparator;
+Atomic<uint32> ControllableContainer::structureGeneration;
 
 ControllableContainer::ControllableContainer(const String& niceName) :
 	ScriptTarget("", this, "Container"),
@@ -30,7 +31,10 @@ ControllableContainer::ControllableContainer(const String& niceName) :
 	notifyStructureChangeWhenLoadingData(true),
 	canBeCopiedAndPasted(false),
 	includeInScriptObject(true),
+	snapshotLayoutGeneration(0),
 	parentContainer(nullptr),
+	addressGeneration(1),
+	cachedControlAddressGeneration(0),
 	queuedNotifier(500) //what to put in max size ??
 						//500 seems ok on my computer, but if too low, generates leaks when closing app while heavy use of async (like  parameter update from audio signal)
 {
@@ -276,6 +280,8 @@ void ControllableContainer::removeControllable(WeakReference<Controllable> c)
 
 void ControllableContainer::notifyStructureChanged()
 {
+	++structureGeneration;
+
 	if (isCurrentlyLoadingData && !notifyStructureChangeWhenLoadingData) return;
 
 	liveScriptObjectIsDirty = true;
@@ -321,6 +327,7 @@ void ControllableContainer::setNiceName(const String& _niceName) {
 	niceName = _niceName;
 	if (!hasCustomShortName) setAutoShortName();
 	liveScriptObjectIsDirty = true;
+	++structureGeneration;
 	onContainerNiceNameChanged();
 }
 
@@ -366,11 +373,18 @@ Parameter* ControllableContainer::getParameterByName(const String& name, bool se
 	return dynamic_cast<Parameter*>(getControllableByName(name, searchNiceNameToo, searchLowerCaseToo));
 }
 
-void ControllableContainer::addChildControllableContainer(ControllableContainer* container, bool owned, int index, bool notify)
+void ControllableContainer::addChildControllableContainer(ControllableContainer* container, bool owned, int index, bool notify, HashSet<String>* takenNames)
 {
-
-	String targetName = (Engine::mainEngine == nullptr || Engine::mainEngine->isLoadingFile) ? container->niceName : getUniqueNameInContainer(container->niceName);
-	container->setNiceName(targetName);
+	if (Engine::mainEngine != nullptr && !Engine::mainEngine->isLoadingFile)
+	{
+		String targetName = takenNames != nullptr ? getUniqueNameInContainer(container->niceName, *takenNames) : getUniqueNameInContainer(container->niceName);
+		container->setNiceName(targetName);
+		if (takenNames != nullptr)
+		{
+			takenNames->add(container->niceName);
+			takenNames->add(container->shortName.toLowerCase());
+		}
+	}
 
 	controllableContainers.insert(index, container);
 	if (owned) ownedContainers.add(container);
@@ -392,8 +406,13 @@ void ControllableContainer::addChildControllableContainer(ControllableContainer*
 
 void ControllableContainer::addChildControllableContainers(Array<ControllableContainer*> containers, bool owned, int index, bool notify)
 {
+	controllableContainers.ensureStorageAllocated(controllableContainers.size() + containers.size());
+
+	HashSet<String> takenNames;
+	if (Engine::mainEngine != nullptr && !Engine::mainEngine->isLoadingFile) fillTakenNames(takenNames);
+
 	int i = index;
-	for (auto& c : containers) addChildControllableContainer(c, owned, i++, false);
+	for (auto& c : containers) addChildControllableContainer(c, owned, index == -1 ? -1 : i++, false, &takenNames);
 	if (notify) notifyStructureChanged();
 }
 
@@ -492,6 +511,24 @@ ControllableContainer* ControllableContainer::getControllableContainerForAddress
 
 String ControllableContainer::getControlAddress(ControllableContainer* relativeTo) {
 
+	if (relativeTo == nullptr && this != Engine::mainEngine)
+	{
+		uint32 generation = addressGeneration.get();
+		{
+			GenericScopedLock<SpinLock> lock(controlAddressLock);
+			if (cachedControlAddressGeneration == generation) return cachedControlAddress;
+		}
+
+		//if this or a parent changes meanwhile, the generation won't match anymore and the address is rebuilt on the next call
+		ControllableContainer* pc = parentContainer.get();
+		String address = (pc != nullptr ? pc->getControlAddress() : String()) + "/" + shortName;
+
+		GenericScopedLock<SpinLock> lock(controlAddressLock);
+		cachedControlAddress = address;
+		cachedControlAddressGeneration = generation;
+		return address;
+	}
+
 	StringArray addressArray;
 	ControllableContainer* pc = this;
 	while (pc != relativeTo && pc != nullptr && pc != Engine::mainEngine)
@@ -515,6 +552,7 @@ void ControllableContainer::orderControllablesAlphabetically()
 void ControllableContainer::setParentContainer(ControllableContainer* container)
 {
 	this->parentContainer = container;
+	++addressGeneration;
 
 	//controllables.getLock().enter();
 	for (auto& c : controllables) if (c != nullptr) c->updateControlAddress();
@@ -528,6 +566,9 @@ void ControllableContainer::setParentContainer(ControllableContainer* container)
 
 void ControllableContainer::updateChildrenControlAddress()
 {
+	//addresses are rebuilt when next asked for, this walk only invalidates them and notifies
+	++addressGeneration;
+
 	//controllables.getLock().enter();
 	for (auto& c : controllables)
 	{
@@ -606,6 +647,78 @@ Array<WeakReference<Parameter>> ControllableContainer::getAllParameters(bool rec
 	return result;
 }
 
+ParameterSnapshotLayout::Ptr ControllableContainer::getSnapshotLayout()
+{
+	if (snapshotLayout == nullptr || snapshotLayoutGeneration != structureGeneration.get())
+	{
+		snapshotLayout = new ParameterSnapshotLayout(this);
+		snapshotLayoutGeneration = structureGeneration.get();
+	}
+
+	return snapshotLayout;
+}
+
+ParameterSnapshot* ControllableContainer::createSnapshot()
+{
+	ParameterSnapshot* s = new ParameterSnapshot(getSnapshotLayout());
+	s->capture();
+	return s;
+}
+
+bool ControllableContainer::hasSameStructureAs(ControllableContainer* other)
+{
+	if (other == nullptr) return false;
+	if (controllables.size() != other->controllables.size() || controllableContainers.size() != other->controllableContainers.size()) return false;
+
+	for (int i = 0; i < controllables.size(); i++)
+	{
+		if (controllables[i]->type != other->controllables[i]->type || controllables[i]->shortName != other->controllables[i]->shortName) return false;
+	}
+
+	for (int i = 0; i < controllableContainers.size(); i++)
+	{
+		ControllableContainer* cc = controllableContainers[i].get();
+		ControllableContainer* occ = other->controllableContainers[i].get();
+		if (cc == nullptr || occ == nullptr || cc->shortName != occ->shortName) return false;
+		if (!cc->hasSameStructureAs(occ)) return false;
+	}
+
+	return true;
+}
+
+void ControllableContainer::copyValuesFrom(ControllableContainer* source, ParameterSnapshot* sourceValues)
+{
+	//expects the same structure (see hasSameStructureAs), values are taken from the snapshot if provided, or from the source's current values
+	if (source == nullptr) return;
+
+	for (int i = 0; i < controllables.size() && i < source->controllables.size(); i++)
+	{
+		Parameter* p = dynamic_cast<Parameter*>(controllables[i]);
+		Parameter* sp = dynamic_cast<Parameter*>(source->controllables[i]);
+		if (p == nullptr || sp == nullptr || p->type != sp->type || !p->isSavable) continue;
+
+		if (sourceValues == nullptr)
+		{
+			p->setValue(sp->getValue());
+			continue;
+		}
+
+		//not captured in the snapshot, its value at that time is unknown
+		int slot = sourceValues->layout->getSlotIndex(sp);
+		if (slot == -1) continue;
+
+		const ParameterSnapshotLayout::Slot& s = sourceValues->layout->slots.getReference(slot);
+		if (s.numFloats > 0) ParameterSnapshot::writeFloats(p, p->type, sourceValues->floatValues.getRawDataPointer() + s.offset, s.numFloats, false);
+		else p->setValue(sourceValues->varValues[s.offset]);
+	}
+
+	for (int i = 0; i < controllableContainers.size() && i < source->controllableContainers.size(); i++)
+	{
+		if (controllableContainers[i] == nullptr || source->controllableContainers[i] == nullptr) continue;
+		controllableContainers[i]->copyValuesFrom(source->controllableContainers[i].get(), sourceValues);
+	}
+}
+
 Array<WeakReference<ControllableContainer>> ControllableContainer::getAllContainers(bool recursive)
 {
 	Array<WeakReference<ControllableContainer>> result;
@@ -947,23 +1060,7 @@ void ControllableContainer::childAddressChanged(ControllableContainer* cc)
 
 String ControllableContainer::getUniqueNameInContainer(const String& sourceName, int suffix)
 {
-	String resultName = sourceName;
-	if (suffix > 0)
-	{
-		StringArray sa;
-		sa.addTokens(resultName, false);
-		if (sa.size() > 1 && (sa[sa.size() - 1].getIntValue() != 0 || sa[sa.size() - 1].containsOnly("0")))
-		{
-			int num = sa[sa.size() - 1].getIntValue() + suffix;
-			sa.remove(sa.size() - 1);
-			sa.add(String(num));
-			resultName = sa.joinIntoString(" ");
-		}
-		else
-		{
-			resultName += " " + String(suffix);
-		}
-	}
+	String resultName = getSuffixedName(sourceName, suffix);
 
 	if (getControllableByName(resultName, true) != nullptr)
 	{
@@ -978,6 +1075,54 @@ String ControllableContainer::getUniqueNameInContainer(const String& sourceName,
 	return resultName;
 }
 
+String ControllableContainer::getUniqueNameInContainer(const String& sourceName, const HashSet<String>& takenNames)
+{
+	int suffix = 0;
+	String resultName = sourceName;
+	while (takenNames.contains(resultName) || takenNames.contains(resultName.toLowerCase()))
+	{
+		suffix++;
+		resultName = getSuffixedName(sourceName, suffix);
+	}
+
+	return resultName;
+}
+
+void ControllableContainer::fillTakenNames(HashSet<String>& takenNames)
+{
+	//same matching rules as getControllableByName and getControllableContainerByName : nice name, or case-insensitive short name
+	for (auto& c : controllables)
+	{
+		if (c == nullptr) continue;
+		takenNames.add(c->niceName);
+		takenNames.add(c->shortName.toLowerCase());
+	}
+
+	for (auto& cc : controllableContainers)
+	{
+		if (cc == nullptr || cc.wasObjectDeleted()) continue;
+		takenNames.add(cc->niceName);
+		takenNames.add(cc->shortName.toLowerCase());
+	}
+}
+
+String ControllableContainer::getSuffixedName(const String& sourceName, int suffix)
+{
+	if (suffix <= 0) return sourceName;
+
+	StringArray sa;
+	sa.addTokens(sourceName, false);
+	if (sa.size() > 1 && (sa[sa.size() - 1].getIntValue() != 0 || sa[sa.size() - 1].containsOnly("0")))
+	{
+		int num = sa[sa.size() - 1].getIntValue() + suffix;
+		sa.remove(sa.size() - 1);
+		sa.add(String(num));
+		return sa.joinIntoString(" ");
+	}
+
+	return sourceName + " " + String(suffix);
+}
+
 void ControllableContainer::updateLiveScriptObjectInternal(DynamicObject* parent)
 {
 	ScriptTarget::updateLiveScriptObjectInternal(parent);
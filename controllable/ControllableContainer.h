@@ -59,6 +59,7 @@ public:
 	bool includeInScriptObject;
 
 	static ControllableComparator comparator;
+	static Atomic<uint32> structureGeneration; //incremented on any structure or name change in the hierarchy, to invalidate caches built over it
 
 	Uuid uid;
 
@@ -67,6 +68,12 @@ public:
 	OwnedArray<ControllableContainer, CriticalSection> ownedContainers;
 	WeakReference<ControllableContainer> parentContainer;
 
+	//the address is built from the parent's on demand and cached, the generation is bumped when this container or any parent is renamed or moved
+	Atomic<uint32> addressGeneration;
+	SpinLock controlAddressLock;
+	String cachedControlAddress;
+	uint32 cachedControlAddressGeneration;
+
 	UndoableAction * setUndoableNiceName(const String &_niceName, bool onlyReturnAction = false);
 	void setNiceName(const String &_niceName);
 	void setCustomShortName(const String &_shortName);
@@ -97,7 +104,7 @@ public:
 	Controllable * getControllableByName(const String &name, bool searchNiceNameToo = false, bool searchLowerCaseToo = true);
 	Parameter * getParameterByName(const String &name, bool searchNiceNameToo = false, bool searchLowerCaseToo = true);
 
-	void addChildControllableContainer(ControllableContainer* container, bool owned = false, int index = -1, bool notify = true);
+	void addChildControllableContainer(ControllableContainer* container, bool owned = false, int index = -1, bool notify = true, HashSet<String>* takenNames = nullptr);
 	void addChildControllableContainers(Array<ControllableContainer *> containers, bool owned = false, int index = -1, bool notify = true);
 	void removeChildControllableContainer(ControllableContainer *container);
 	
@@ -113,6 +120,16 @@ public:
 	virtual Array<WeakReference<Controllable>> getAllControllables(bool recursive = false, bool getNotExposed = false);
 	virtual Array<WeakReference<Parameter>> getAllParameters(bool recursive = false, bool getNotExposed = false);
 	virtual Array<WeakReference<ControllableContainer>> getAllContainers(bool recursive = false);
+
+	//snapshots, the layout is cached until the structure of the hierarchy changes
+	ParameterSnapshotLayout::Ptr snapshotLayout;
+	uint32 snapshotLayoutGeneration;
+	ParameterSnapshotLayout::Ptr getSnapshotLayout();
+	ParameterSnapshot* createSnapshot();
+
+	//native clone of the values, without going through getJSONData / loadJSONData
+	bool hasSameStructureAs(ControllableContainer* other);
+	void copyValuesFrom(ControllableContainer* source, ParameterSnapshot* sourceValues = nullptr);
 	virtual Controllable * getControllableForAddress(const String &address, bool recursive = true, bool getNotExposed = false);
 	virtual Controllable * getControllableForAddress(StringArray addressSplit, bool recursive = true, bool getNotExposed = false);
 	bool containsControllable(Controllable * c, int maxSearchLevels = -1);
@@ -146,6 +163,9 @@ public:
 	virtual void childAddressChanged(ControllableContainer *) override;
 	
 	String getUniqueNameInContainer(const String &sourceName, int suffix = 0);
+	String getUniqueNameInContainer(const String &sourceName, const HashSet<String> &takenNames);
+	void fillTakenNames(HashSet<String> &takenNames); //fills the set with all child names, for bulk adding without rescanning children for each name
+	static String getSuffixedName(const String &sourceName, int suffix);
 
 	//SCRIPT
 	virtual void updateLiveScriptObjectInternal(DynamicObject * parent = nullptr) override;
@@ -9,6 +9,96 @@
 */
 
 
+//CACHE
+
+juce_ImplementSingleton(ControllableChooserCache)
+
+ControllableChooserCache::MenuCache * ControllableChooserCache::getCache(ControllableContainer* root, const String& key, bool& isUpToDate)
+{
+	MenuCache* cache = nullptr;
+	for (int i = caches.size() - 1; i >= 0; i--)
+	{
+		MenuCache* c = caches[i];
+		if (c->root == nullptr || c->root.wasObjectDeleted())
+		{
+			caches.remove(i);
+			continue;
+		}
+
+		if (cache == nullptr && c->root.get() == root && c->key == key) cache = c;
+	}
+
+	if (cache == nullptr)
+	{
+		if (caches.size() >= maxCaches) caches.remove(0);
+
+		cache = new MenuCache();
+		cache->root = root;
+		cache->key = key;
+		cache->generation = ControllableContainer::structureGeneration.get() - 1;
+		caches.add(cache);
+	}
+	else
+	{
+		caches.move(caches.indexOf(cache), caches.size() - 1);
+	}
+
+	isUpToDate = cache->generation == ControllableContainer::structureGeneration.get();
+	if (!isUpToDate)
+	{
+		cache->menu = PopupMenu();
+		cache->controllables.clearQuick();
+		cache->containers.clearQuick();
+		cache->searchAddresses.clearQuick();
+		cache->generation = ControllableContainer::structureGeneration.get();
+	}
+
+	return cache;
+}
+
+void ControllableChooserCache::clear()
+{
+	caches.clear();
+}
+
+Array<int> ControllableChooserCache::search(const StringArray& addresses, const String& query, int maxResults)
+{
+	Array<int> result;
+	StringArray tokens;
+	tokens.addTokens(query.toLowerCase(), " /", "");
+	tokens.removeEmptyStrings();
+	if (tokens.isEmpty()) return result;
+
+	for (int i = 0; i < addresses.size() && result.size() < maxResults; i++)
+	{
+		bool match = true;
+		for (auto& t : tokens)
+		{
+			if (!addresses[i].contains(t))
+			{
+				match = false;
+				break;
+			}
+		}
+
+		if (match) result.add(i);
+	}
+
+	return result;
+}
+
+String ControllableChooserCache::askForSearchQuery(const String& title)
+{
+	AlertWindow window(title, "Type part of the address, words can be separated by spaces", AlertWindow::NoIcon);
+	window.addTextEditor("query", "");
+	window.addButton("Search", 1, KeyPress(KeyPress::returnKey));
+	window.addButton("Cancel", 0, KeyPress(KeyPress::escapeKey));
+
+	if (window.runModalLoop() == 0) return String();
+	return window.getTextEditorContents("query");
+}
+
+
 //CONTROLLABLE
 
 ControllableChooserPopupMenu::ControllableChooserPopupMenu(ControllableContainer * rootContainer, bool _showParameters, bool _showTriggers, int _indexOffset, int _maxDefaultSearchLevel, StringArray typesFilter) :
@@ -22,7 +112,29 @@ ControllableChooserPopupMenu::ControllableChooserPopupMenu(ControllableContainer
 
 	if (rootContainer == nullptr) rootContainer = Engine::mainEngine;
 	jassert(rootContainer != nullptr);
-	populateMenu(this, rootContainer, id);
+
+	String key = "c/" + String((int)showParameters) + String((int)showTriggers) + "/" + String(indexOffset) + "/" + String(maxDefaultSearchLevel) + "/" + typesFilter.joinIntoString(",");
+	bool isUpToDate = false;
+	ControllableChooserCache::MenuCache* cache = ControllableChooserCache::getInstance()->getCache(rootContainer, key, isUpToDate);
+
+	if (!isUpToDate)
+	{
+		populateMenu(&cache->menu, rootContainer, id);
+		for (auto& c : controllableList)
+		{
+			cache->controllables.add(c);
+			cache->searchAddresses.add(c->getControlAddress(rootContainer).toLowerCase());
+		}
+	}
+	else
+	{
+		controllableList.ensureStorageAllocated(cache->controllables.size());
+		for (auto& c : cache->controllables) controllableList.add(c.get());
+	}
+
+	controllableRefs = cache->controllables;
+	searchAddresses = cache->searchAddresses;
+	PopupMenu::operator=(cache->menu);
 }
 
 ControllableChooserPopupMenu::~ControllableChooserPopupMenu()
@@ -75,13 +187,40 @@ void ControllableChooserPopupMenu::populateMenu(PopupMenu * subMenu, Controllabl
 
 Controllable * ControllableChooserPopupMenu::showAndGetControllable()
 {
+	if (!controllableList.isEmpty())
+	{
+		addSeparator();
+		addItem(searchResultId, "Search...");
+	}
+
 	int result = show();
+	if (result == searchResultId) return showSearchAndGetControllable();
 	return getControllableForResult(result);
 }
 
+Controllable* ControllableChooserPopupMenu::showSearchAndGetControllable()
+{
+	String query = ControllableChooserCache::askForSearchQuery("Search a controllable");
+	if (query.isEmpty()) return nullptr;
+
+	Array<int> indices = ControllableChooserCache::search(searchAddresses, query);
+	PopupMenu p;
+	if (indices.isEmpty()) p.addItem(searchResultId, "No result", false);
+	for (auto& i : indices)
+	{
+		if (controllableRefs[i].wasObjectDeleted()) continue;
+		p.addItem(i + 1, controllableList[i]->getControlAddress());
+	}
+
+	int result = p.show();
+	if (result <= 0) return nullptr;
+	return getControllableForResult(result + indexOffset);
+}
+
 Controllable * ControllableChooserPopupMenu::getControllableForResult(int result)
 {
 	if (result <= indexOffset || (result - 1 - indexOffset) >= controllableList.size()) return nullptr;
+	if (controllableRefs[result - 1 - indexOffset].wasObjectDeleted()) return nullptr;
 	return controllableList[result - 1 - indexOffset];
 }
 
@@ -97,7 +236,38 @@ ContainerChooserPopupMenu::ContainerChooserPopupMenu(ControllableContainer * roo
 
 	if (rootContainer == nullptr) rootContainer = Engine::mainEngine;
 	jassert(rootContainer != nullptr);
-	populateMenu(this, rootContainer, id);
+
+	//a check function can only be part of the key if it's a plain function (like ContainerTypeChecker::checkType), lambdas get their own cache each time
+	String funcKey = "none";
+	if (typeCheckFunc != nullptr)
+	{
+		auto funcPtr = typeCheckFunc.target<bool(*)(ControllableContainer*)>();
+		funcKey = funcPtr != nullptr ? String::toHexString((pointer_sized_int)*funcPtr) : String();
+	}
+
+	String key = "cc/" + String(indexOffset) + "/" + String(maxDefaultSearchLevel) + "/" + funcKey;
+	bool isUpToDate = false;
+	ControllableChooserCache::MenuCache localCache;
+	ControllableChooserCache::MenuCache* cache = funcKey.isNotEmpty() ? ControllableChooserCache::getInstance()->getCache(rootContainer, key, isUpToDate) : &localCache;
+
+	if (!isUpToDate)
+	{
+		populateMenu(&cache->menu, rootContainer, id);
+		for (auto& cc : containerList)
+		{
+			cache->containers.add(cc);
+			cache->searchAddresses.add(cc->getControlAddress(rootContainer).toLowerCase());
+		}
+	}
+	else
+	{
+		containerList.ensureStorageAllocated(cache->containers.size());
+		for (auto& cc : cache->containers) containerList.add(cc.get());
+	}
+
+	containerRefs = cache->containers;
+	searchAddresses = cache->searchAddresses;
+	PopupMenu::operator=(cache->menu);
 }
 
 ContainerChooserPopupMenu::~ContainerChooserPopupMenu()
@@ -138,13 +308,40 @@ void ContainerChooserPopupMenu::populateMenu(PopupMenu * subMenu, ControllableCo
 
 ControllableContainer * ContainerChooserPopupMenu::showAndGetContainer()
 {
+	if (!containerList.isEmpty())
+	{
+		addSeparator();
+		addItem(searchResultId, "Search...");
+	}
+
 	int result = show();
+	if (result == searchResultId) return showSearchAndGetContainer();
 	return getContainerForResult(result);
 }
 
+ControllableContainer* ContainerChooserPopupMenu::showSearchAndGetContainer()
+{
+	String query = ControllableChooserCache::askForSearchQuery("Search a container");
+	if (query.isEmpty()) return nullptr;
+
+	Array<int> indices = ControllableChooserCache::search(searchAddresses, query);
+	PopupMenu p;
+	if (indices.isEmpty()) p.addItem(searchResultId, "No result", false);
+	for (auto& i : indices)
+	{
+		if (containerRefs[i].wasObjectDeleted()) continue;
+		p.addItem(i + 1, containerList[i]->getControlAddress());
+	}
+
+	int result = p.show();
+	if (result <= 0) return nullptr;
+	return getContainerForResult(result + indexOffset);
+}
+
 ControllableContainer * ContainerChooserPopupMenu::getContainerForResult(int result)
 {
 	if (result <= indexOffset || (result - 1 - indexOffset) >= containerList.size()) return nullptr;
+	if (containerRefs[result - 1 - indexOffset].wasObjectDeleted()) return nullptr;
 	return containerList[result - 1 - indexOffset];
 }
 
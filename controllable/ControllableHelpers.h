@@ -10,6 +10,39 @@
 
 #pragma once
 
+//Chooser menus are cached per root and options, and only rebuilt when ControllableContainer::structureGeneration has changed.
+//Caches of deleted roots are dropped, and the least recently used ones are evicted past maxCaches
+class ControllableChooserCache
+{
+public:
+	juce_DeclareSingleton(ControllableChooserCache, true);
+
+	ControllableChooserCache() {}
+	~ControllableChooserCache() {}
+
+	class MenuCache
+	{
+	public:
+		WeakReference<ControllableContainer> root;
+		String key;
+		uint32 generation = 0;
+		PopupMenu menu;
+		Array<WeakReference<Controllable>> controllables;
+		Array<WeakReference<ControllableContainer>> containers;
+		StringArray searchAddresses; //lower case addresses relative to the root, in the same order as controllables or containers
+	};
+
+	OwnedArray<MenuCache> caches; //most recently used last
+
+	static const int maxCaches = 32;
+
+	MenuCache * getCache(ControllableContainer * root, const String &key, bool &isUpToDate);
+	void clear();
+
+	static Array<int> search(const StringArray &addresses, const String &query, int maxResults = 100);
+	static String askForSearchQuery(const String &title);
+};
+
 class ControllableChooserPopupMenu : 
 	public PopupMenu
 {
@@ -23,10 +56,15 @@ public:
 	bool showTriggers;
 	StringArray typesFilter;
 
+	static const int searchResultId = -1;
+
 	Array<Controllable *> controllableList;
+	Array<WeakReference<Controllable>> controllableRefs;
+	StringArray searchAddresses;
 	void populateMenu(PopupMenu *subMenu, ControllableContainer * container, int &currentId, int currentLevel = 0);
 
 	Controllable * showAndGetControllable();
+	Controllable * showSearchAndGetControllable();
 	Controllable * getControllableForResult(int result);
 };
 
@@ -52,10 +90,15 @@ public:
 	int maxDefaultSearchLevel;
 	std::function<bool(ControllableContainer *)> typeCheckFunc;
 
+	static const int searchResultId = -1;
+
 	Array<ControllableContainer *> containerList;
+	Array<WeakReference<ControllableContainer>> containerRefs;
+	StringArray searchAddresses;
 	void populateMenu(PopupMenu *subMenu, ControllableContainer * container, int &currentId, int currentLevel = 0);
 
 	ControllableContainer * showAndGetContainer();
+	ControllableContainer * showSearchAndGetContainer();
 	ControllableContainer * getContainerForResult(int result);
 };
 
@@ -0,0 +1,244 @@
+/*
+  ==============================================================================
+
+    ParameterSnapshot.cpp
+    Created: 18 Oct 2026 9:26:33pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+ParameterSnapshotLayout::ParameterSnapshotLayout(ControllableContainer* root, std::function<bool(Parameter*)> filterFunc) :
+	root(root),
+	numFloats(0),
+	numVars(0)
+{
+	if (root == nullptr) return;
+
+	Array<WeakReference<Parameter>> params = root->getAllParameters(true, true);
+	for (auto& p : params)
+	{
+		if (p.wasObjectDeleted() || p == nullptr) continue;
+		if (p->isControllableFeedbackOnly || !p->isSavable) continue;
+		if (filterFunc != nullptr && !filterFunc(p.get())) continue;
+
+		Slot s;
+		s.parameter = p;
+		s.type = p->type;
+		s.numFloats = getNumFloatsForType(p->type);
+		s.offset = s.numFloats > 0 ? numFloats : numVars;
+
+		if (s.numFloats > 0) numFloats += s.numFloats;
+		else numVars++;
+
+		slotIndices.set(p.get(), slots.size());
+		slots.add(s);
+	}
+}
+
+int ParameterSnapshotLayout::getSlotIndex(Parameter* p) const
+{
+	return slotIndices.contains(p) ? slotIndices[p] : -1;
+}
+
+int ParameterSnapshotLayout::getNumFloatsForType(Controllable::Type t)
+{
+	switch (t)
+	{
+	case Controllable::FLOAT:
+	case Controllable::INT:
+	case Controllable::BOOL:
+		return 1;
+
+	case Controllable::POINT2D: return 2;
+	case Controllable::POINT3D: return 3;
+	case Controllable::COLOR: return 4;
+
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+
+
+ParameterSnapshot::ParameterSnapshot(ParameterSnapshotLayout::Ptr layout) :
+	layout(layout)
+{
+	jassert(layout != nullptr);
+	floatValues.resize(layout->numFloats);
+	varValues.resize(layout->numVars);
+}
+
+void ParameterSnapshot::capture()
+{
+	float* f = floatValues.getRawDataPointer();
+	for (auto& s : layout->slots)
+	{
+		Parameter* p = s.parameter.get();
+		if (p == nullptr) continue;
+
+		if (s.numFloats > 0) readFloats(p, s.type, f + s.offset);
+		else varValues.set(s.offset, p->getValue());
+	}
+}
+
+void ParameterSnapshot::recall(float weight, bool silentSet)
+{
+	const float* f = floatValues.getRawDataPointer();
+	float current[4];
+	float target[4];
+
+	for (auto& s : layout->slots)
+	{
+		Parameter* p = s.parameter.get();
+		if (p == nullptr) continue;
+
+		if (s.numFloats == 0)
+		{
+			var v = varValues[s.offset];
+			p->setValue(weight >= 1 ? v : p->getLerpValueTo(v, weight), silentSet);
+			continue;
+		}
+
+		//same as getLerpValueTo but without going through var for each step
+		if (weight >= 1) memcpy(target, f + s.offset, sizeof(float) * s.numFloats);
+		else
+		{
+			readFloats(p, s.type, current);
+			for (int i = 0; i < s.numFloats; i++) target[i] = jmap(weight, current[i], f[s.offset + i]);
+		}
+
+		writeFloats(p, s.type, target, s.numFloats, silentSet);
+	}
+}
+
+void ParameterSnapshot::morph(const Array<ParameterSnapshot*>& snapshots, const Array<float>& weights, bool silentSet)
+{
+	jassert(snapshots.size() == weights.size());
+	if (snapshots.isEmpty() || snapshots.size() != weights.size()) return;
+
+	float totalWeight = 0;
+	int mainIndex = 0;
+	for (int i = 0; i < weights.size(); i++)
+	{
+		totalWeight += weights[i];
+		if (weights[i] > weights[mainIndex]) mainIndex = i;
+	}
+
+	if (totalWeight <= 0) return;
+
+	ParameterSnapshotLayout::Ptr layout = snapshots[mainIndex]->layout;
+	float current[4];
+	float target[4];
+
+	for (int i = 0; i < layout->slots.size(); i++)
+	{
+		const ParameterSnapshotLayout::Slot& s = layout->slots.getReference(i);
+		Parameter* p = s.parameter.get();
+		if (p == nullptr) continue;
+
+		if (s.numFloats == 0)
+		{
+			p->setValue(snapshots[mainIndex]->varValues[s.offset], silentSet);
+			continue;
+		}
+
+		//same as setWeightedValue, snapshots taken with another layout are remapped by parameter
+		bool hasCurrent = false;
+		for (int j = 0; j < s.numFloats; j++) target[j] = 0;
+
+		for (int si = 0; si < snapshots.size(); si++)
+		{
+			ParameterSnapshot* snapshot = snapshots[si];
+			float w = weights[si] / totalWeight;
+
+			const float* f = nullptr;
+			if (snapshot->layout == layout) f = snapshot->floatValues.getRawDataPointer() + s.offset;
+			else
+			{
+				int index = snapshot->layout->getSlotIndex(p);
+				if (index >= 0) f = snapshot->floatValues.getRawDataPointer() + snapshot->layout->slots.getReference(index).offset;
+			}
+
+			if (f == nullptr)
+			{
+				if (!hasCurrent) readFloats(p, s.type, current);
+				hasCurrent = true;
+				f = current;
+			}
+
+			for (int j = 0; j < s.numFloats; j++) target[j] += f[j] * w;
+		}
+
+		writeFloats(p, s.type, target, s.numFloats, silentSet);
+	}
+}
+
+void ParameterSnapshot::readFloats(Parameter* p, Controllable::Type t, float* result)
+{
+	switch (t)
+	{
+	case Controllable::FLOAT:
+	case Controllable::INT:
+	case Controllable::BOOL:
+		result[0] = (float)p->value;
+		break;
+
+	case Controllable::POINT2D:
+	{
+		Point2DParameter* pp = (Point2DParameter*)p;
+		result[0] = pp->x;
+		result[1] = pp->y;
+	}
+	break;
+
+	case Controllable::POINT3D:
+	{
+		Point3DParameter* pp = (Point3DParameter*)p;
+		result[0] = pp->x;
+		result[1] = pp->y;
+		result[2] = pp->z;
+	}
+	break;
+
+	case Controllable::COLOR:
+		memcpy(result, ((ColorParameter*)p)->colorValues, sizeof(float) * 4);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void ParameterSnapshot::writeFloats(Parameter* p, Controllable::Type t, const float* values, int numFloats, bool silentSet)
+{
+	//values that didn't change are skipped before building any var
+	float current[4];
+	readFloats(p, t, current);
+
+	bool changed = p->alwaysNotify;
+	for (int i = 0; i < numFloats && !changed; i++) changed = current[i] != values[i];
+	if (!changed) return;
+
+	switch (t)
+	{
+	case Controllable::FLOAT: p->setValue(values[0], silentSet); break;
+	case Controllable::INT: p->setValue(roundToInt(values[0]), silentSet); break;
+	case Controllable::BOOL: p->setValue(values[0] >= .5f, silentSet); break;
+
+	default:
+	{
+		bool asInt = t == Controllable::COLOR && ((ColorParameter*)p)->mode == ColorParameter::UINT;
+		var v;
+		for (int i = 0; i < numFloats; i++)
+		{
+			if (asInt) v.append(roundToInt(values[i]));
+			else v.append(values[i]);
+		}
+		p->setValue(v, silentSet);
+	}
+	break;
+	}
+}
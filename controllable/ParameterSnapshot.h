@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    ParameterSnapshot.h
+    Created: 18 Oct 2026 9:26:33pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class ControllableContainer;
+
+//Stable index of the parameters of a container hierarchy, shared by all snapshots taken from it
+class ParameterSnapshotLayout :
+	public ReferenceCountedObject
+{
+public:
+	ParameterSnapshotLayout(ControllableContainer* root, std::function<bool(Parameter*)> filterFunc = nullptr);
+	~ParameterSnapshotLayout() {}
+
+	struct Slot
+	{
+		WeakReference<Parameter> parameter;
+		Controllable::Type type;
+		int offset; //in the float buffer, or in the var buffer if numFloats is 0
+		int numFloats;
+	};
+
+	WeakReference<ControllableContainer> root;
+	Array<Slot> slots;
+	HashMap<Parameter*, int> slotIndices;
+	int numFloats;
+	int numVars;
+
+	int getSlotIndex(Parameter* p) const;
+
+	static int getNumFloatsForType(Controllable::Type t);
+
+	typedef ReferenceCountedObjectPtr<ParameterSnapshotLayout> Ptr;
+};
+
+//Typed values of all the parameters of a layout, numeric values are stored in a single contiguous float buffer
+class ParameterSnapshot
+{
+public:
+	ParameterSnapshot(ParameterSnapshotLayout::Ptr layout);
+	~ParameterSnapshot() {}
+
+	ParameterSnapshotLayout::Ptr layout;
+	Array<float> floatValues;
+	Array<var> varValues; //strings, enums, targets, files..
+
+	void capture();
+	void recall(float weight = 1, bool silentSet = false);
+
+	//weights are normalized, non numeric values are taken from the snapshot with the highest weight
+	static void morph(const Array<ParameterSnapshot*>& snapshots, const Array<float>& weights, bool silentSet = false);
+
+	static void readFloats(Parameter* p, Controllable::Type t, float* result);
+	static void writeFloats(Parameter* p, Controllable::Type t, const float* values, int numFloats, bool silentSet);
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterSnapshot)
+};
@@ -15,7 +15,7 @@ BoolParameter::BoolParameter(const String & niceName, const String &description,
 	maximumValue = 1;
 	canHaveRange = true;
     setValue(initialValue);
-	argumentsDescription = "0/1";
+	argumentsDescription = getPooledString("0/1");
 }
 
 BoolToggleUI * BoolParameter::createToggle(BoolParameter * target)
@@ -29,6 +29,7 @@ ColorParameter::ColorParameter(const String & niceName, const String & descripti
 	minimumValue = minVal;
 	maximumValue = maxVal;
 
+	for (int i = 0; i < 4; i++) colorValues[i] = 0;
 	setColor(initialColor, false, true);
 }
 
@@ -38,11 +39,8 @@ const Colour ColorParameter::getColor()
 {
 	GenericScopedLock<SpinLock> lock(valueSetLock);
 
-	if (!value.isArray()) return Colours::black;
-	while (value.size() < 4) value.append(0);
-
-	if (mode == FLOAT) return Colour((uint8)((float)value[0]*255), (uint8)((float)value[1]*255), (uint8)((float)value[2]*255), (uint8)((float)value[3]*255));
-	else return Colour((uint8)(int)value[0], (uint8)(int)value[1], (uint8)(int)value[2], (uint8)(int)value[3]);
+	if (mode == FLOAT) return Colour((uint8)(colorValues[0]*255), (uint8)(colorValues[1]*255), (uint8)(colorValues[2]*255), (uint8)(colorValues[3]*255));
+	else return Colour((uint8)colorValues[0], (uint8)colorValues[1], (uint8)colorValues[2], (uint8)colorValues[3]);
 }
 
 void ColorParameter::setFloatRGBA(const float & r, const float & g, const float & b, const float & a)
@@ -57,23 +55,33 @@ void ColorParameter::setColor(const uint32 & _color, bool silentSet, bool force)
 
 void ColorParameter::setColor(const Colour &_color, bool silentSet, bool force)
 {
-	var colorVar;
+	float c[4];
 	if (mode == FLOAT)
 	{
-		colorVar.append(_color.getFloatRed());
-		colorVar.append(_color.getFloatGreen());
-		colorVar.append(_color.getFloatBlue());
-		colorVar.append(_color.getFloatAlpha());
+		c[0] = _color.getFloatRed();
+		c[1] = _color.getFloatGreen();
+		c[2] = _color.getFloatBlue();
+		c[3] = _color.getFloatAlpha();
 	}
 	else
 	{
-		colorVar.append(_color.getRed());
-		colorVar.append(_color.getGreen());
-		colorVar.append(_color.getBlue());
-		colorVar.append(_color.getAlpha());
+		c[0] = _color.getRed();
+		c[1] = _color.getGreen();
+		c[2] = _color.getBlue();
+		c[3] = _color.getAlpha();
+	}
+
+	{
+		//colorValues hold the value, the var is only rebuilt when it's read or notified
+		GenericScopedLock<SpinLock> lock(valueSetLock);
+		if (!force && !alwaysNotify && c[0] == colorValues[0] && c[1] == colorValues[1] && c[2] == colorValues[2] && c[3] == colorValues[3]) return;
+
+		for (int i = 0; i < 4; i++) colorValues[i] = c[i];
+		valueVarIsStale = true;
+		isOverriden = true;
 	}
-	
-	setValue(colorVar, silentSet, force);
+
+	if (!silentSet) notifyValueChanged();
 }
 
 StringArray ColorParameter::getValuesNames()
@@ -81,6 +89,38 @@ StringArray ColorParameter::getValuesNames()
 	return StringArray("Red", "Green", "Blue", "Alpha");
 }
 
+void ColorParameter::setValueInternal(var& _value)
+{
+	Parameter::setValueInternal(_value);
+
+	if (!value.isArray())
+	{
+		for (int i = 0; i < 3; i++) colorValues[i] = 0;
+		colorValues[3] = mode == FLOAT ? 1.0f : 255; //opaque black
+		return;
+	}
+
+	for (int i = 0; i < 4; i++) colorValues[i] = i < value.size() ? (float)value[i] : 0;
+}
+
+var ColorParameter::getValue()
+{
+	GenericScopedLock<SpinLock> lock(valueSetLock);
+	updateValueVar();
+	return value;
+}
+
+var ColorParameter::createValueVar()
+{
+	var colorVar;
+	for (int i = 0; i < 4; i++)
+	{
+		if (mode == FLOAT) colorVar.append(colorValues[i]);
+		else colorVar.append((int)colorValues[i]);
+	}
+	return colorVar;
+}
+
 bool ColorParameter::checkValueIsTheSame(var oldValue, var newValue)
 {
 	if (!(newValue.isArray() && oldValue.isArray())) return false;
@@ -93,13 +133,10 @@ bool ColorParameter::checkValueIsTheSame(var oldValue, var newValue)
 
 var ColorParameter::getLerpValueTo(var targetValue, float weight)
 {
-	if (!targetValue.isArray()) return value;
+	if (!targetValue.isArray()) return getValue();
 	GenericScopedLock<SpinLock> lock(valueSetLock);
 	var result;
-	result.append(jmap(weight, (float)value[0], (float)targetValue[0]));
-	result.append(jmap(weight, (float)value[1], (float)targetValue[1]));
-	result.append(jmap(weight, (float)value[2], (float)targetValue[2]));
-	result.append(jmap(weight, (float)value[3], (float)targetValue[3]));
+	for (int i = 0; i < 4; i++) result.append(jmap(weight, colorValues[i], (float)targetValue[i]));
 	return result;
 }
 
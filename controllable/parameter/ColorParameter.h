@@ -22,6 +22,7 @@ public:
 	~ColorParameter();
 
 	Mode mode;
+	float colorValues[4]; //holds the value in the mode's unit, value is rebuilt from it when read
 
 	const Colour getColor();
 	void setFloatRGBA(const float &r, const float &g, const float &b, const float &a);
@@ -30,6 +31,8 @@ public:
 
 	virtual StringArray getValuesNames() override;
 
+	var getValue() override;
+	void setValueInternal(var &_value) override;
 	bool checkValueIsTheSame(var oldValue, var newValue) override;
 
 	virtual var getLerpValueTo(var targetValue, float weight) override;
@@ -44,4 +47,7 @@ public:
 	virtual String getTypeString() const override { return getTypeStringStatic(); }
 	static String getTypeStringStatic() { return "Color"; }
 
+protected:
+	var createValueVar() override;
+
 };
\ No newline at end of file
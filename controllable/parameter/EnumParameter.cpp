@@ -11,7 +11,8 @@
 
 
 EnumParameter::EnumParameter(const String & niceName, const String &description, bool enabled) :
-	Parameter(Type::ENUM, niceName, description, "" ,var(),var(), enabled)
+	Parameter(Type::ENUM, niceName, description, "" ,var(),var(), enabled),
+	selectedIndex(-1)
 {
 	lockManualControlMode = true;
 
@@ -23,6 +24,12 @@ EnumParameter::EnumParameter(const String & niceName, const String &description,
 EnumParameter * EnumParameter::addOption(String key, var data, bool selectIfFirstOption)
 {
 	enumValues.add(new EnumValue(key, data));
+	if (!keyIndexMap.contains(key))
+	{
+		keyIndexMap.set(key, enumValues.size() - 1);
+		if (key == value.toString()) selectedIndex = enumValues.size() - 1; //value may have been set before its option was added
+	}
+
 	if (enumValues.size() == 1 && selectIfFirstOption)
 	{
 		defaultValue = key;
@@ -37,6 +44,7 @@ EnumParameter * EnumParameter::addOption(String key, var data, bool selectIfFirs
 void EnumParameter::removeOption(String key)
 {
 	enumValues.remove(getIndexForKey(key));
+	rebuildKeyIndexMap();
 	enumListeners.call(&Listener::enumOptionRemoved, this, key);
 	updateArgDescription();
 }
@@ -64,7 +72,7 @@ var EnumParameter::getValue()
 }
 
 var EnumParameter::getValueData() {
-	EnumValue * ev = getEntryForKey(value.toString());
+	EnumValue * ev = enumValues[selectedIndex];
 	if (ev == nullptr) return var();
 	return ev->value;
 }
@@ -75,9 +83,8 @@ String EnumParameter::getValueKey() {
 
 int EnumParameter::getIndexForKey(StringRef key)
 {
-	int numValues = enumValues.size();
-	for (int i = 0; i < numValues; i++) if (enumValues[i]->key == key) return i;
-	return -1;
+	String k(key);
+	return keyIndexMap.contains(k) ? keyIndexMap[k] : -1;
 }
 
 EnumParameter::EnumValue * EnumParameter::getEntryForKey(StringRef key)
@@ -114,7 +121,7 @@ void EnumParameter::setValueWithKey(String key)
 void EnumParameter::setNext(bool loop, bool addToUndo)
 {
 
-	int targetIndex = getIndexForKey(value.toString()) + 1;
+	int targetIndex = selectedIndex + 1;
 	if (targetIndex >= enumValues.size())
 	{
 		if (loop) targetIndex = 0;
@@ -127,6 +134,19 @@ void EnumParameter::setNext(bool loop, bool addToUndo)
 	else setValueWithKey(newValue);
 }
 
+void EnumParameter::setValueInternal(var& _value)
+{
+	Parameter::setValueInternal(_value);
+	selectedIndex = getIndexForKey(value.toString());
+}
+
+void EnumParameter::rebuildKeyIndexMap()
+{
+	keyIndexMap.clear();
+	for (int i = enumValues.size() - 1; i >= 0; i--) keyIndexMap.set(enumValues[i]->key, i); //first option wins for duplicate keys
+	selectedIndex = getIndexForKey(value.toString());
+}
+
 bool EnumParameter::checkValueIsTheSame(var oldValue, var newValue)
 {
 	return oldValue.toString() == newValue.toString();
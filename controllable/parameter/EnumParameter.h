@@ -35,12 +35,16 @@ public:
 
 	OwnedArray<EnumValue> enumValues;
 
+	//The value is still the key (for saving and loading), these are kept in sync with it so typed reads don't have to compare strings
+	HashMap<String, int> keyIndexMap;
+	int selectedIndex;
+
 	var getValue() override;
 	var getValueData();
 
 	template<class T>
 	T getValueDataAsEnum() {
-		EnumValue * ev = getEntryForKey(value.toString());
+		EnumValue * ev = enumValues[selectedIndex];
 		if (ev == nullptr) return (T)0;
 		return (T)(int)ev->value; 
 	}
@@ -56,7 +60,10 @@ public:
 	void setValueWithKey(String data);
 	void setNext(bool loop = true, bool addToUndo = false);
 
+	void setValueInternal(var &_value) override;
 	bool checkValueIsTheSame(var oldValue, var newValue) override;
+
+	void rebuildKeyIndexMap();
 	
 	static var getValueDataFromScript(const juce::var::NativeFunctionArgs& a);
 	static var addOptionFromScript(const juce::var::NativeFunctionArgs &a);
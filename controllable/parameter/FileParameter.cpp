@@ -14,7 +14,8 @@ FileParameter::FileParameter(const String & niceName, const String &description,
 	customBasePath(""),
 	directoryMode(false),
     forceAbsolutePath(false),
-	forceRelativePath(false)
+	forceRelativePath(false),
+	autoReload(false)
 {
 	defaultUI = FILE; 
 
@@ -28,6 +29,7 @@ FileParameter::FileParameter(const String & niceName, const String &description,
 
 FileParameter::~FileParameter()
 {
+	if (autoReload) if (FileWatcher* w = FileWatcher::getInstanceWithoutCreating()) w->removeAllWatches(this);
 	if(Engine::mainEngine != nullptr) Engine::mainEngine->removeEngineListener(this);
 }
 
@@ -48,6 +50,8 @@ void FileParameter::setValueInternal(var &newVal)
 	}
 	
 	value = value.toString().replace("\\", "/");
+
+	if (autoReload) updateFileWatch();
 }
 
 void FileParameter::setForceRelativePath(bool force)
@@ -56,6 +60,22 @@ void FileParameter::setForceRelativePath(bool force)
 	setValue(absolutePath, false, true);
 }
 
+void FileParameter::setAutoReload(bool value)
+{
+	if (autoReload == value) return;
+	autoReload = value;
+	updateFileWatch();
+}
+
+void FileParameter::updateFileWatch()
+{
+	FileWatcher* w = autoReload ? FileWatcher::getInstance() : FileWatcher::getInstanceWithoutCreating();
+	if (w == nullptr) return;
+
+	w->removeAllWatches(this);
+	if (autoReload && absolutePath.isNotEmpty() && value.toString().isNotEmpty()) w->addWatch(File::createFileWithoutCheckingPath(absolutePath), this);
+}
+
 bool FileParameter::isRelativePath(const String & p)
 {
 	if (p.isEmpty()) return false;
@@ -103,6 +123,11 @@ void FileParameter::fileSaved(bool savedAs)
 	if(savedAs) setValue(absolutePath, false, true); //force re-evaluate relative path if changed
 }
 
+void FileParameter::watchedFileChanged(const File&)
+{
+	notifyValueChanged(); //owners reload the file as if the path had been set again
+}
+
 var FileParameter::readFileFromScript(const juce::var::NativeFunctionArgs& a)
 {
 	FileParameter* p = getObjectFromJS<FileParameter>(a);
@@ -11,7 +11,8 @@
 
 class FileParameter : 
 	public StringParameter,
-	public EngineListener
+	public EngineListener,
+	public FileWatcher::Listener
 {
 public:
     FileParameter(const String &niceName, const String &description, const String &initialValue, bool enabled=true);
@@ -25,11 +26,14 @@ public:
 
 	bool forceAbsolutePath;
     bool forceRelativePath;
+	bool autoReload; //notify a value change when the file is modified on disk
     
     // need to override this function because var Strings comparison  is based on pointer (we need full string comp)
     virtual void setValueInternal(var&) override;
 	
 	void setForceRelativePath(bool value);
+	void setAutoReload(bool value);
+	void updateFileWatch();
 
 	bool isRelativePath(const String &p);
 	String getAbsolutePath() const;
@@ -40,6 +44,7 @@ public:
 	void loadJSONDataInternal(var data) override;
 
 	void fileSaved(bool savedAs) override;
+	void watchedFileChanged(const File& f) override;
 
 	static var readFileFromScript(const juce::var::NativeFunctionArgs& a);
 	static var writeFileFromScript(const juce::var::NativeFunctionArgs& a);
@@ -16,7 +16,7 @@ FloatParameter::FloatParameter(const String & niceName, const String &descriptio
 {
 	canHaveRange = true;
 	canBeAutomated = true;
-	argumentsDescription = "float";
+	argumentsDescription = getPooledString("float");
 }
 
 var FloatParameter::getLerpValueTo(var targetValue, float weight)
@@ -16,7 +16,7 @@ IntParameter::IntParameter(const String& niceName, const String& description, co
 {
 	canHaveRange = true;
 	canBeAutomated = true;
-	argumentsDescription = "int";
+	argumentsDescription = getPooledString("int");
 }
 
 void IntParameter::setValueInternal(var& _value)
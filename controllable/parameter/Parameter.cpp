@@ -12,6 +12,7 @@ Parameter::Parameter(const Type& type, const String& niceName, const String& des
 	Controllable(type, niceName, description, enabled),
 	defaultValue(initialValue),
 	value(initialValue),
+	valueVarIsStale(false),
 	canHaveRange(false),
 	minimumValue(minValue),
 	maximumValue(maxValue),
@@ -149,6 +150,7 @@ void Parameter::setValue(var _value, bool silentSet, bool force, bool forceOverr
 {
 	{
 		GenericScopedLock<SpinLock> lock(valueSetLock);
+		updateValueVar();
 
 		var croppedValue = getCroppedValue(_value);
 
@@ -182,6 +184,7 @@ void Parameter::setRange(var min, var max) {
 
 	{
 		GenericScopedLock<SpinLock> lock(valueSetLock);
+		updateValueVar();
 		if (isComplex() && (!(min.isArray() && min.size() == value.size()) || !(max.isArray() && max.size() == value.size()))) return;
 		if (minimumValue == min && maximumValue == max) return;
 		minimumValue = min;
@@ -212,6 +215,7 @@ void Parameter::setValueInternal(var & _value) //to override by child classes
 {
 
 	value = _value;
+	valueVarIsStale = false;
 
 	jassert(checkVarIsConsistentWithType());
 }
@@ -243,6 +247,13 @@ var Parameter::getCroppedValue(var originalValue)
 	return originalValue;
 }
 
+void Parameter::updateValueVar()
+{
+	if (!valueVarIsStale) return;
+	value = createValueVar();
+	valueVarIsStale = false;
+}
+
 void Parameter::setUndoableNormalizedValue(const float & oldNormalizedValue, const float & newNormalizedValue)
 {
 	setUndoableValue(jmap<float>(oldNormalizedValue, (float)minimumValue, (float)maximumValue), jmap<float>(newNormalizedValue, (float)minimumValue, (float)maximumValue));
@@ -332,7 +343,11 @@ DashboardItem* Parameter::createDashboardItem()
 var Parameter::getJSONDataInternal()
 {
 	var data = Controllable::getJSONDataInternal();
-	data.getDynamicObject()->setProperty("value", value);
+	{
+		GenericScopedLock<SpinLock> lock(valueSetLock);
+		updateValueVar();
+		data.getDynamicObject()->setProperty("value", value);
+	}
 	
 	if (controlMode != MANUAL)
 	{
@@ -419,3 +434,15 @@ bool Parameter::ParameterSetValueAction::undo()
 	p->setValue(oldValue);
 	return true;
 }
+
+int Parameter::ParameterSetValueAction::getSizeInUnits()
+{
+	return (int)sizeof(*this) + controlAddress.getNumBytesAsUTF8() + UndoMaster::getVarSize(oldValue) + UndoMaster::getVarSize(newValue);
+}
+
+UndoableAction* Parameter::ParameterSetValueAction::createCoalescedAction(UndoableAction* nextAction)
+{
+	ParameterSetValueAction* a = dynamic_cast<ParameterSetValueAction*>(nextAction);
+	if (a == nullptr || a->parameterRef != parameterRef || parameterRef.wasObjectDeleted()) return nullptr;
+	return new ParameterSetValueAction(parameterRef.get(), oldValue, a->newValue);
+}
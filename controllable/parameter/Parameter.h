@@ -43,9 +43,12 @@ public:
 	virtual ~Parameter();
 
     var defaultValue;
-    var value;
+    var value; //may lag behind the native members of points and colors, see valueVarIsStale
     var lastValue;
 
+	//Set when a subclass writes its native members (x/y, colorValues...) without rebuilding value, it's rebuilt on the next read
+	bool valueVarIsStale;
+
 	SpinLock valueSetLock;
 
 	//Range
@@ -176,6 +179,9 @@ public:
 protected:
 	virtual var getCroppedValue(var originalValue);
 
+	void updateValueVar(); //valueSetLock must be held
+	virtual var createValueVar() { return value; } //builds value from the native members
+
 public:
 	class ParameterAction :
 		public ControllableAction
@@ -211,6 +217,9 @@ public:
 		
 		bool perform() override;
 		bool undo() override;
+
+		int getSizeInUnits() override;
+		UndoableAction * createCoalescedAction(UndoableAction * nextAction) override;
 	};
 
 	private:
@@ -32,7 +32,7 @@ Point2DParameter::Point2DParameter(const String & niceName, const String & descr
 	maximumValue.append((float)INT32_MAX);
 
 	//hideInEditor = true;
-	argumentsDescription = "float, float";
+	argumentsDescription = getPooledString("float, float");
 }
 
 
@@ -43,10 +43,20 @@ void Point2DParameter::setPoint(Point<float> point)
 
 void Point2DParameter::setPoint(float _x, float _y)
 {
-	var d;
-	d.append(_x);
-	d.append(_y);
-	setValue(d);
+	{
+		//x and y hold the value, the var is only rebuilt when it's read or notified
+		GenericScopedLock<SpinLock> lock(valueSetLock);
+		float cx = jlimit<float>(minimumValue[0], maximumValue[0], _x);
+		float cy = jlimit<float>(minimumValue[1], maximumValue[1], _y);
+		if (!alwaysNotify && cx == x && cy == y) return;
+
+		x = cx;
+		y = cy;
+		valueVarIsStale = true;
+		isOverriden = true;
+	}
+
+	notifyValueChanged();
 }
 
 UndoableAction * Point2DParameter::setUndoablePoint(Point<float> oldPoint, Point<float> newPoint, bool onlyReturnAction)
@@ -56,6 +66,8 @@ UndoableAction * Point2DParameter::setUndoablePoint(Point<float> oldPoint, Point
 
 UndoableAction* Point2DParameter::setUndoablePoint(float oldX, float oldY, float newX, float newY, bool onlyReturnAction)
 {
+	if (oldX == newX && oldY == newY && !alwaysNotify) return nullptr;
+
 	var od;
 	od.append(oldX);
 	od.append(oldY);
@@ -63,8 +75,6 @@ UndoableAction* Point2DParameter::setUndoablePoint(float oldX, float oldY, float
 	d.append(newX);
 	d.append(newY);
 
-	if (checkValueIsTheSame(od, d) && !alwaysNotify) return nullptr;
-
 	return setUndoableValue(od, d, onlyReturnAction);
 }
 
@@ -100,9 +110,16 @@ Point<float> Point2DParameter::getPoint() {
 	return Point<float>(x, y);
 }
 
+var Point2DParameter::getValue()
+{
+	GenericScopedLock<SpinLock> lock(valueSetLock);
+	updateValueVar();
+	return value;
+}
+
 var Point2DParameter::getLerpValueTo(var targetValue, float weight)
 {
-	if (!targetValue.isArray()) return value;
+	if (!targetValue.isArray()) return getValue();
 	var result;
 	result.append(jmap(weight, x, (float)targetValue[0]));
 	result.append(jmap(weight, y, (float)targetValue[1]));
@@ -147,7 +164,20 @@ var Point2DParameter::getCroppedValue(var originalValue)
 {
 	jassert(originalValue.isArray() && minimumValue.isArray() && maximumValue.isArray());
 
+	//most values are already in range, avoid building a new array for them
+	bool isInRange = originalValue.size() == 2;
+	for (int i = 0; i < 2 && isInRange; i++) isInRange = (float)originalValue[i] >= (float)minimumValue[i] && (float)originalValue[i] <= (float)maximumValue[i];
+	if (isInRange) return originalValue;
+
 	var val;
 	for (int i = 0; i < 2; i++) val.append(jlimit(minimumValue[i], maximumValue[i], originalValue[i]));
 	return val;
 }
+
+var Point2DParameter::createValueVar()
+{
+	var val;
+	val.append(x);
+	val.append(y);
+	return val;
+}
@@ -31,6 +31,7 @@ public:
 	virtual StringArray getValuesNames() override;
 
 	Point<float> getPoint();
+	var getValue() override;
 	virtual var getLerpValueTo(var targetValue, float weight) override;
 	virtual void setWeightedValue(Array<var> values, Array<float> weights) override;
 
@@ -46,4 +47,5 @@ public:
 
 protected:
 	virtual var getCroppedValue(var originalValue) override;
+	var createValueVar() override;
 };
@@ -37,7 +37,7 @@ Point3DParameter::Point3DParameter(const String & niceName, const String & descr
 	maximumValue.append(INT32_MAX);
 
 	//hideInEditor = true;
-	argumentsDescription = "float, float, float";
+	argumentsDescription = getPooledString("float, float, float");
 }
 
 void Point3DParameter::setVector(Vector3D<float> _value)
@@ -47,11 +47,22 @@ void Point3DParameter::setVector(Vector3D<float> _value)
 
 void Point3DParameter::setVector(float _x, float _y, float _z)
 {
-	var d;
-	d.append(_x);
-	d.append(_y);
-	d.append(_z);
-	setValue(d);
+	{
+		//x, y and z hold the value, the var is only rebuilt when it's read or notified
+		GenericScopedLock<SpinLock> lock(valueSetLock);
+		float cx = jlimit<float>(minimumValue[0], maximumValue[0], _x);
+		float cy = jlimit<float>(minimumValue[1], maximumValue[1], _y);
+		float cz = jlimit<float>(minimumValue[2], maximumValue[2], _z);
+		if (!alwaysNotify && cx == x && cy == y && cz == z) return;
+
+		x = cx;
+		y = cy;
+		z = cz;
+		valueVarIsStale = true;
+		isOverriden = true;
+	}
+
+	notifyValueChanged();
 }
 
 void Point3DParameter::setUndoableVector(Vector3D<float> oldVector, Vector3D<float> newVector)
@@ -61,6 +72,8 @@ void Point3DParameter::setUndoableVector(Vector3D<float> oldVector, Vector3D<flo
 
 void Point3DParameter::setUndoableVector(float oldX, float oldY, float oldZ, float newX, float newY, float newZ)
 {
+	if (oldX == newX && oldY == newY && oldZ == newZ && !alwaysNotify) return;
+
 	var od;
 	od.append(oldX);
 	od.append(oldY);
@@ -70,8 +83,6 @@ void Point3DParameter::setUndoableVector(float oldX, float oldY, float oldZ, flo
 	d.append(newY);
 	d.append(newZ);
 
-	if (checkValueIsTheSame(od, d) && !alwaysNotify) return;
-
 	setUndoableValue(od, d);
 }
 
@@ -105,9 +116,16 @@ Vector3D<float> Point3DParameter::getVector() {
 	return Vector3D<float>(x, y, z);
 }
 
+var Point3DParameter::getValue()
+{
+	GenericScopedLock<SpinLock> lock(valueSetLock);
+	updateValueVar();
+	return value;
+}
+
 var Point3DParameter::getLerpValueTo(var targetValue, float weight)
 {
-	if (!targetValue.isArray()) return value;
+	if (!targetValue.isArray()) return getValue();
 	var result;
 	result.append(jmap(weight, x, (float)targetValue[0]));
 	result.append(jmap(weight, y, (float)targetValue[1]));
@@ -158,7 +176,21 @@ var Point3DParameter::getCroppedValue(var originalValue)
 {
 	jassert(originalValue.isArray() && minimumValue.isArray() && maximumValue.isArray());
 
+	//most values are already in range, avoid building a new array for them
+	bool isInRange = originalValue.size() == 3;
+	for (int i = 0; i < 3 && isInRange; i++) isInRange = (float)originalValue[i] >= (float)minimumValue[i] && (float)originalValue[i] <= (float)maximumValue[i];
+	if (isInRange) return originalValue;
+
 	var val;
 	for (int i = 0; i < 3; i++) val.append(jlimit(minimumValue[i], maximumValue[i], originalValue[i]));
 	return val;
 }
+
+var Point3DParameter::createValueVar()
+{
+	var val;
+	val.append(x);
+	val.append(y);
+	val.append(z);
+	return val;
+}
@@ -30,6 +30,7 @@ public:
 	void clearRange() override;
 
 	Vector3D<float> getVector();
+	var getValue() override;
 	virtual var getLerpValueTo(var targetValue, float weight) override;
 	virtual void setWeightedValue(Array<var> values, Array<float> weights) override;
 
@@ -45,4 +46,5 @@ public:
 
 protected:
 	var getCroppedValue(var originalValue) override;
+	var createValueVar() override;
 };
\ No newline at end of file
@@ -15,7 +15,7 @@ StringParameter::StringParameter(const String & niceName, const String &descript
 	multiline(false),
 	autoTrim(false)
 {
-	argumentsDescription = "string";
+	argumentsDescription = getPooledString("string");
 	isCustomizableByUser = false; //avoid having the param wheel 
 }
 
@@ -22,6 +22,7 @@ TargetParameter::TargetParameter(const String & niceName, const String & descrip
 	rootContainer(nullptr),
 	target(nullptr),
 	targetContainer(nullptr),
+	isPendingResolution(false),
 	customGetTargetFunc(nullptr),
 	customGetControllableLabelFunc(nullptr),
 	customCheckAssignOnNextChangeFunc(nullptr),
@@ -39,11 +40,13 @@ TargetParameter::TargetParameter(const String & niceName, const String & descrip
 	
 	scriptObject.setMethod("getTarget", TargetParameter::getTargetFromScript);
 
-	argumentsDescription = "target";
+	argumentsDescription = getPooledString("target");
 }
 
 TargetParameter::~TargetParameter()
 {
+	if (TargetParameterResolver* r = TargetParameterResolver::getInstanceWithoutCreating()) r->removePending(this);
+
 	setRootContainer(nullptr);
 
 	setTarget((ControllableContainer *)nullptr);
@@ -55,7 +58,7 @@ void TargetParameter::setGhostValue(const String & ghostVal)
 {
 	if (ghostVal == ghostValue) return;
 	ghostValue = ghostVal;
-	if (ghostValue.isNotEmpty() && target == nullptr && targetContainer == nullptr) setWarningMessage("Link is broken !");
+	if (ghostValue.isNotEmpty() && target == nullptr && targetContainer == nullptr && !isPendingResolution) setWarningMessage("Link is broken !");
 	
 }
 
@@ -103,8 +106,28 @@ void TargetParameter::setValueFromTarget(ControllableContainer * cc, bool addToU
 void TargetParameter::setValueInternal(var & newVal)
 {
 	StringParameter::setValueInternal(newVal);
+
 	if (newVal.toString().isNotEmpty())
 	{
+		//already pointing there (e.g. value updated after a rename), no need to search the tree again
+		bool isCurrentTarget = (targetType == CONTAINER && targetContainer != nullptr && !targetContainer.wasObjectDeleted() && targetContainer->getControlAddress(rootContainer) == newVal.toString())
+			|| (targetType == CONTROLLABLE && target != nullptr && !target.wasObjectDeleted() && target->getControlAddress(rootContainer) == newVal.toString());
+
+		if (isCurrentTarget)
+		{
+			setGhostValue(newVal.toString());
+			return;
+		}
+
+		if (TargetParameterResolver::isDeferring())
+		{
+			//the tree is not complete yet, all targets are resolved in one pass when the file is loaded
+			TargetParameterResolver::getInstance()->addPending(this);
+			if (targetType == CONTAINER) setTarget((ControllableContainer *)nullptr);
+			else setTarget((Controllable *)nullptr);
+			return;
+		}
+
 		if (targetType == CONTAINER)
 		{
 			WeakReference<ControllableContainer> cc = rootContainer->getControllableContainerForAddress(newVal.toString(),true);
@@ -126,6 +149,7 @@ void TargetParameter::setValueInternal(var & newVal)
 		}
 	} else
 	{
+		if (TargetParameterResolver* r = TargetParameterResolver::getInstanceWithoutCreating()) r->removePending(this);
 		if(targetType == CONTAINER) setTarget((ControllableContainer *)nullptr);
 		else setTarget((ControllableContainer *)nullptr);
 
@@ -157,7 +181,7 @@ void TargetParameter::setTarget(WeakReference<Controllable> c)
 	}
 	else
 	{
-		if (ghostValue.isNotEmpty()) setWarningMessage("Link is broken : " + ghostValue);
+		if (ghostValue.isNotEmpty() && !isPendingResolution) setWarningMessage("Link is broken : " + ghostValue);
 		else clearWarning();
 	}
 }
@@ -185,7 +209,7 @@ void TargetParameter::setTarget(WeakReference<ControllableContainer> cc)
 	}
 	else
 	{
-		if (ghostValue.isNotEmpty()) setWarningMessage("Link is broken : " + ghostValue);
+		if (ghostValue.isNotEmpty() && !isPendingResolution) setWarningMessage("Link is broken : " + ghostValue);
 		else clearWarning();
 	}
 }
@@ -206,36 +230,30 @@ void TargetParameter::setRootContainer(WeakReference<ControllableContainer> newR
 void TargetParameter::childStructureChanged(ControllableContainer * cc)
 {
 	if (Engine::mainEngine != nullptr && Engine::mainEngine->isClearing) return;
+	if (isPendingResolution) return;
 
 	if (targetType == CONTROLLABLE)
 	{
-		if (target == nullptr)
-		{
-			if (ghostValue.isNotEmpty())
-			{
-				WeakReference<Controllable> c = rootContainer->getControllableForAddress(ghostValue);
-				if (c != nullptr) setValueFromTarget(c);
-			}
-		} else
-		{
-			setValueFromTarget(target);
-		}
+		//a linked controllable gets its own address change callback, only broken links need a new lookup
+		if (target == nullptr && ghostValue.isNotEmpty()) TargetParameterResolver::getInstance()->addPending(this);
 	} else if (targetType == CONTAINER)
 	{
 		if (targetContainer == nullptr)
 		{
-			if (ghostValue.isNotEmpty())
-			{
-				WeakReference<ControllableContainer> tcc = rootContainer->getControllableContainerForAddress(ghostValue);
-				if (tcc != nullptr) setValueFromTarget(tcc);
-			}
-		} else
+			if (ghostValue.isNotEmpty()) TargetParameterResolver::getInstance()->addPending(this);
+		} else if (targetContainer->getControlAddress(rootContainer) != ghostValue)
 		{
+			//only the target's own parent chain is checked : it has been renamed or moved since the link was made
 			setValueFromTarget(targetContainer);
 		}
 	}
 }
 
+void TargetParameter::controllableControlAddressChanged(Controllable* c)
+{
+	if (targetType == CONTROLLABLE && c == target.get()) setValueFromTarget(target);
+}
+
 void TargetParameter::inspectableDestroyed(Inspectable * i)
 {
 	if ((targetType == CONTAINER && targetContainer == nullptr) || (targetType == CONTROLLABLE && target == nullptr))
@@ -43,6 +43,8 @@ public:
 	
 	WeakReference<Controllable> target;
 	WeakReference<ControllableContainer> targetContainer;
+
+	bool isPendingResolution; //queued in TargetParameterResolver, the target will be set later
 	
 	std::function<Controllable*(bool, bool)> customGetTargetFunc;
 	std::function<String(Controllable*)> customGetControllableLabelFunc;
@@ -65,6 +67,7 @@ public:
 	void setRootContainer(WeakReference<ControllableContainer> newRootContainer);
 
 	void childStructureChanged(ControllableContainer *) override;
+	void controllableControlAddressChanged(Controllable* c) override;
 
 	void inspectableDestroyed(Inspectable * i) override;
 
@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    TargetParameterResolver.cpp
+    Created: 18 Oct 2026 9:34:01pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+juce_ImplementSingleton(TargetParameterResolver)
+
+TargetParameterResolver::~TargetParameterResolver()
+{
+	cancelPendingUpdate();
+	for (auto& p : pendingTargets) if (p != nullptr) p->isPendingResolution = false;
+	pendingTargets.clear();
+	resolvingTargets.clear();
+}
+
+bool TargetParameterResolver::isDeferring()
+{
+	return Engine::mainEngine != nullptr && Engine::mainEngine->isLoadingFile;
+}
+
+void TargetParameterResolver::addPending(TargetParameter* p)
+{
+	if (p == nullptr || p->isPendingResolution) return;
+	p->isPendingResolution = true;
+	pendingTargets.add(p);
+
+	//while loading, the engine resolves everything at once when the file has been loaded
+	if (!isDeferring()) triggerAsyncUpdate();
+}
+
+void TargetParameterResolver::removePending(TargetParameter* p)
+{
+	if (p == nullptr || !p->isPendingResolution) return;
+	p->isPendingResolution = false;
+
+	int index = pendingTargets.indexOf(p);
+	if (index >= 0) pendingTargets.set(index, nullptr); //keep the order, the array is compacted after the next pass
+
+	//listeners notified during a pass may delete other parameters of that same pass
+	index = resolvingTargets.indexOf(p);
+	if (index >= 0) resolvingTargets.set(index, nullptr);
+}
+
+void TargetParameterResolver::resolvePending()
+{
+	cancelPendingUpdate();
+	if (pendingTargets.isEmpty()) return;
+
+	if (resolvingTargets.size() > 0)
+	{
+		//called again from a notification of the current pass
+		triggerAsyncUpdate();
+		return;
+	}
+
+	OwnedArray<AddressTable> tables;
+
+	//resolving can add new pending targets through notifications, they will be handled in the next pass
+	resolvingTargets.swapWith(pendingTargets);
+	pendingTargets.clearQuick();
+
+	int numTargets = 0;
+	for (auto& p : resolvingTargets) if (p != nullptr) numTargets++;
+	const bool useTables = numTargets >= addressTableThreshold;
+
+	for (int i = 0; i < resolvingTargets.size(); i++)
+	{
+		TargetParameter* p = resolvingTargets[i];
+		if (p == nullptr || !p->isPendingResolution) continue;
+		p->isPendingResolution = false;
+		resolvingTargets.set(i, nullptr);
+
+		ControllableContainer* root = p->rootContainer.get();
+		String address = p->stringValue().isNotEmpty() ? p->stringValue() : p->ghostValue;
+		if (root == nullptr || address.isEmpty()) continue;
+		if (!address.startsWith("/")) address = "/" + address;
+
+		AddressTable* table = nullptr;
+		if (useTables)
+		{
+			for (auto& t : tables) if (t->root == root) table = t;
+			if (table == nullptr) table = tables.add(new AddressTable(root));
+		}
+
+		bool found = false;
+		if (p->targetType == TargetParameter::CONTAINER)
+		{
+			WeakReference<ControllableContainer> cc;
+			if (table != nullptr) cc = table->containers[address];
+			if (cc == nullptr || cc.wasObjectDeleted()) cc = root->getControllableContainerForAddress(address, true); //lower case or nice name matches
+			p->setTarget(cc);
+			found = cc != nullptr;
+		}
+		else
+		{
+			WeakReference<Controllable> c;
+			if (table != nullptr) c = table->controllables[address];
+			if (c == nullptr || c.wasObjectDeleted()) c = root->getControllableForAddress(address, true);
+			p->setTarget(c);
+			found = c != nullptr;
+		}
+
+		if (!found) continue;
+
+		//listeners have been notified before the target existed, notify them again now that it's there
+		if (p->stringValue() != address) p->setValue(address, false, true);
+		else p->notifyValueChanged();
+	}
+
+	resolvingTargets.clearQuick();
+
+	if (pendingTargets.size() > 0 && !isDeferring()) triggerAsyncUpdate();
+}
+
+void TargetParameterResolver::handleAsyncUpdate()
+{
+	if (isDeferring()) return;
+	resolvePending();
+}
+
+TargetParameterResolver::AddressTable::AddressTable(ControllableContainer* root) :
+	root(root)
+{
+	if (root != nullptr) addContainer(root, "");
+}
+
+void TargetParameterResolver::AddressTable::addContainer(ControllableContainer* cc, const String& address)
+{
+	//same addresses as getControlAddress(root), built in a single walk
+	for (auto& c : cc->controllables)
+	{
+		if (c == nullptr || !c->isControllableExposed) continue;
+		String cAddress = address + "/" + c->shortName;
+		if (!controllables.contains(cAddress)) controllables.set(cAddress, c);
+	}
+
+	for (auto& child : cc->controllableContainers)
+	{
+		if (child == nullptr || child.wasObjectDeleted()) continue;
+		String childAddress = address + "/" + child->shortName;
+		if (!containers.contains(childAddress)) containers.set(childAddress, child.get());
+		addContainer(child.get(), childAddress);
+	}
+}
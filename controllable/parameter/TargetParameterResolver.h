@@ -0,0 +1,50 @@
+/*
+  ==============================================================================
+
+    TargetParameterResolver.h
+    Created: 18 Oct 2026 9:34:01pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class TargetParameter;
+
+//Resolves TargetParameters in bulk : targets set while a file is loading, and broken links after a structure change,
+//are queued and resolved in a single pass, against an address table built once per root container when there are many of them
+class TargetParameterResolver :
+	public AsyncUpdater
+{
+public:
+	juce_DeclareSingleton(TargetParameterResolver, true);
+
+	TargetParameterResolver() {}
+	~TargetParameterResolver();
+
+	class AddressTable
+	{
+	public:
+		AddressTable(ControllableContainer* root);
+
+		WeakReference<ControllableContainer> root;
+		HashMap<String, WeakReference<Controllable>> controllables;
+		HashMap<String, WeakReference<ControllableContainer>> containers;
+
+		void addContainer(ControllableContainer* cc, const String& address);
+	};
+
+	Array<TargetParameter*> pendingTargets;
+	Array<TargetParameter*> resolvingTargets; //the pass in progress, entries are nulled if the parameter is removed meanwhile
+
+	static const int addressTableThreshold = 32; //below this number of targets, direct lookups are cheaper than walking the whole tree
+
+	static bool isDeferring();
+
+	void addPending(TargetParameter* p);
+	void removePending(TargetParameter* p);
+	void resolvePending();
+
+	void handleAsyncUpdate() override;
+};
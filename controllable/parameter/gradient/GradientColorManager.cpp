@@ -13,11 +13,13 @@ GradientColorComparator GradientColorManager::comparator;
 
 GradientColorManager::GradientColorManager(float maxPosition, bool addDefaultColors, bool dedicatedSelectionManager) :
 	BaseManager("Colors"),
-	allowKeysOutside(true)
+	allowKeysOutside(true),
+	bakeResolution(1024)
 {
 
 	editorIsCollapsed = true;
 	selectItemWhenCreated = false;
+	BaseManager::comparator.compareFunc = [](GradientColor * t1, GradientColor * t2) { return comparator.compareElements(t1, t2); };
 
 	position = addFloatParameter("Position", "Position in the gradient", 0, 0, maxPosition);
 	position->isSavable = false;
@@ -47,10 +49,7 @@ GradientColorManager::GradientColorManager(float maxPosition, bool addDefaultCol
 		addColorAt(length->floatValue() * 4 / 5, Colours::blue);
 	}
 	
-	//rebuildGradient();
-
-
-	currentColor->setColor(getColorForPosition(position->floatValue()));
+	rebuildGradient();
 }
 
 GradientColorManager::~GradientColorManager()
@@ -76,51 +75,99 @@ void GradientColorManager::setLength(float val, bool stretch, bool stickToEnd)
 
 Colour GradientColorManager::getColorForPosition(const float & time) const
 {
-	if (items.isEmpty()) return Colours::transparentBlack;
-	if (time <= items[0]->position->floatValue()) return items[0]->color->getColor();
-	if (time >= items[items.size() - 1]->position->floatValue()) return items[items.size() - 1]->color->getColor();
+	GenericScopedLock<SpinLock> lock(gradientLock);
+	return getColorFromKeys(time);
+}
+
+void GradientColorManager::fillColours(float start, float end, Colour* out, int numColours) const
+{
+	if (numColours <= 0) return;
+
+	GenericScopedLock<SpinLock> lock(gradientLock);
+	const float step = numColours > 1 ? (end - start) / (numColours - 1) : 0;
+	const bool useBaked = !bakedColors.isEmpty();
 
-	GradientColor * nearest = getItemAt(time, true);
+	for (int i = 0; i < numColours; i++)
+	{
+		const float time = start + step * i;
+		out[i] = useBaked ? getColorFromBaked(time) : getColorFromKeys(time);
+	}
+}
 
-	if (nearest == nullptr) return Colours::purple;
+Colour GradientColorManager::getColorFromKeys(float time) const
+{
+	const int numKeys = keyPositions.size();
+	if (numKeys == 0) return Colours::transparentBlack;
+	if (time <= keyPositions[0]) return keyColors[0];
+	if (time >= keyPositions[numKeys - 1]) return keyColors[numKeys - 1];
 
-	GradientColor::Interpolation interpolation = nearest->interpolation->getValueDataAsEnum<GradientColor::Interpolation>();
+	int index = (int)(std::upper_bound(keyPositions.begin(), keyPositions.end(), time) - keyPositions.begin()) - 1;
+	while (index > 0 && keyPositions[index - 1] == time) index--; //first of the keys at this exact position, as getItemAt
 
-	switch (interpolation)
+	switch (keyInterpolations[index])
 	{
 	case GradientColor::NONE:
-		return nearest->color->getColor();
-		break;
+		return keyColors[index];
 
 	case GradientColor::LINEAR:
 	{
-		GradientColor * next = items[items.indexOf(nearest) + 1];
-		if (nearest == nullptr || next == nullptr || nearest->position->floatValue() == next->position->floatValue()) return nearest->color->getColor();
-		return nearest->color->getColor().interpolatedWith(next->color->getColor(), jmap<float>(time, nearest->position->floatValue(), next->position->floatValue(), 0, 1));
+		const float pos = keyPositions[index];
+		const float nextPos = keyPositions[index + 1];
+		if (pos == nextPos) return keyColors[index];
+		return keyColors[index].interpolatedWith(keyColors[index + 1], jmap<float>(time, pos, nextPos, 0, 1));
 	}
-	break;
 	}
 
 	return Colours::purple;
 }
 
-/*
-void GradientColorManager::rebuildGradient()
+Colour GradientColorManager::getColorFromBaked(float time) const
+{
+	const float firstPos = keyPositions.getFirst();
+	const float lastPos = keyPositions.getLast();
+	if (time <= firstPos) return keyColors.getFirst();
+	if (time >= lastPos) return keyColors.getLast();
+
+	return bakedColors[roundToInt(jmap<float>(time, firstPos, lastPos, 0, bakedColors.size() - 1))];
+}
+
+void GradientColorManager::setBakeResolution(int resolution)
 {
-	gradientLock.enter();
-	gradient.clearColours();
-	if (items.size() > 0 && items[0]->position->floatValue() > 0) gradient.addColour(0, items[0]->color->getColor(), items[0]->interpolation->getValueDataAsEnum<ColourGradient::Interpolation>());
+	if (bakeResolution == resolution) return;
+	bakeResolution = jmax(resolution, 0);
+	rebuildGradient();
+}
 
-	for (auto &i : items)
+void GradientColorManager::rebuildGradient()
+{
 	{
-		i->gradientIndex = gradient.addColour(jlimit<float>(0,1,i->position->floatValue() / length->floatValue()), i->color->getColor(), i->interpolation->getValueDataAsEnum<ColourGradient::Interpolation>());
+		GenericScopedLock<SpinLock> lock(gradientLock);
+
+		keyPositions.clearQuick();
+		keyColors.clearQuick();
+		keyInterpolations.clearQuick();
+
+		for (auto& i : items)
+		{
+			keyPositions.add(i->position->floatValue());
+			keyColors.add(i->color->getColor());
+			keyInterpolations.add(i->interpolation->getValueDataAsEnum<GradientColor::Interpolation>());
+		}
+
+		bakedColors.clearQuick();
+		if (bakeResolution > 1 && keyPositions.size() > 1 && keyPositions.getLast() > keyPositions.getFirst())
+		{
+			bakedColors.ensureStorageAllocated(bakeResolution);
+			for (int i = 0; i < bakeResolution; i++)
+			{
+				bakedColors.add(getColorFromKeys(jmap<float>(i, 0, bakeResolution - 1, keyPositions.getFirst(), keyPositions.getLast())));
+			}
+		}
 	}
-	gradientLock.exit();
 
 	currentColor->setColor(getColorForPosition(position->floatValue()));
 	colorManagerListeners.call(&GradientColorManagerListener::gradientUpdated);
 }
-*/
 
 GradientColor * GradientColorManager::addColorAt(float time, Colour color)
 {
@@ -136,22 +183,29 @@ GradientColor * GradientColorManager::addColorAt(float time, Colour color)
 		t->color->setColor(color);
 	}
 	
-	reorderItems();
-	//rebuildGradient();
+	if (reorderItem(t)) rebuildGradient();
 	return t;
 }
 
 GradientColor * GradientColorManager::getItemAt(float time, bool getNearestPreviousKeyIfNotFound) const
 {
-	GradientColor * nearestPrevious = nullptr;
-	for (auto &t : items)
+	//dichotomy on sorted keys, first key after time
+	int low = 0;
+	int high = items.size();
+	while (low < high)
 	{
-		if (t->position->floatValue() == time) return t;
-		if (t->position->floatValue() > time) break; //avoid looking for further keys, todo : implement dichotomy mechanism
-		nearestPrevious = t;
+		int mid = (low + high) / 2;
+		if (items[mid]->position->floatValue() <= time) low = mid + 1;
+		else high = mid;
 	}
 
-	return getNearestPreviousKeyIfNotFound ? nearestPrevious : nullptr;
+	int index = low - 1;
+	if (index < 0) return nullptr;
+	while (index > 0 && items[index - 1]->position->floatValue() == time) index--;
+
+	GradientColor* t = items[index];
+	if (t->position->floatValue() == time) return t;
+	return getNearestPreviousKeyIfNotFound ? t : nullptr;
 }
 
 void GradientColorManager::addItemInternal(GradientColor * item, var data)
@@ -159,17 +213,18 @@ void GradientColorManager::addItemInternal(GradientColor * item, var data)
 	//item->gradientIndex = gradient.addColour(item->position->floatValue() / length->floatValue(), item->color->getColor());
 	if(!allowKeysOutside) item->position->setRange(0, length->floatValue());
 	item->selectionManager = selectionManager;
+	if (!isCurrentlyLoadingData) rebuildGradient();
 }
 
 void GradientColorManager::removeItemInternal(GradientColor *)
 {
-	//rebuildGradient();
+	rebuildGradient();
 }
 
 void GradientColorManager::reorderItems()
 {
-	items.sort(GradientColorManager::comparator, true);
 	BaseManager::reorderItems();
+	rebuildGradient();
 }
 
 void GradientColorManager::onContainerParameterChanged(Parameter * p)
@@ -187,38 +242,18 @@ void GradientColorManager::onControllableFeedbackUpdate(ControllableContainer *
 	{
 		if (c == t->position)
 		{
-			int index = items.indexOf(t);
-			if (index > 0 && t->position->floatValue() < items[index - 1]->position->floatValue())
-			{
-				items.swap(index, index - 1);
-				baseManagerListeners.call(&ManagerListener::itemsReordered);
-			}
-			else if (index < items.size() - 1 && t->position->floatValue() > items[index + 1]->position->floatValue())
-			{
-				items.swap(index, index + 1);
-				baseManagerListeners.call(&ManagerListener::itemsReordered);
-			}
-
-		}
-		else if (c == t->color) {
-			//gradient.setColour(t->gradientIndex, t->color->getColor());
-			colorManagerListeners.call(&GradientColorManagerListener::gradientUpdated);
-		}
-		else if (c == t->interpolation)
-		{
-			//gradient.setInterpolation(t->gradientIndex, t->interpolation->getValueDataAsEnum<ColourGradient::Interpolation>());
-			colorManagerListeners.call(&GradientColorManagerListener::gradientUpdated);
+			reorderItem(t);
 		}
+		else if (c != t->color && c != t->interpolation) return;
 
-		//rebuildGradient();
-		currentColor->setColor(getColorForPosition(position->floatValue()));
+		rebuildGradient();
 	}
 }
 
 void GradientColorManager::loadJSONDataInternal(var data)
 {
 	BaseManager::loadJSONDataInternal(data);
-	//rebuildGradient();
+	rebuildGradient();
 }
 
 InspectableEditor* GradientColorManager::getEditor(bool isRoot)
@@ -43,9 +43,20 @@ public:
 
 	static GradientColorComparator comparator;
 
+	//Keys are copied here on each change so lookups don't have to go through the parameters, guarded by gradientLock
+	Array<float> keyPositions;
+	Array<Colour> keyColors;
+	Array<GradientColor::Interpolation> keyInterpolations;
+
+	//Baked gradient between the first and last keys, used by fillColours. 0 to disable baking and compute each color from the keys
+	int bakeResolution;
+	Array<Colour> bakedColors;
+
 	Colour getColorForPosition(const float & time) const;
-	
-	//void rebuildGradient();
+	void fillColours(float start, float end, Colour * out, int numColours) const;
+
+	void setBakeResolution(int resolution);
+	void rebuildGradient();
 	
 	GradientColor * addColorAt(float time, Colour color);
 	GradientColor * getItemAt(float time, bool getNearestPreviousKeyIfNotFound = false) const;
@@ -74,5 +85,9 @@ public:
 	void removeColorManagerListener(GradientColorManagerListener* listener) { colorManagerListeners.remove(listener); }
 
 
+private:
+	Colour getColorFromKeys(float time) const; //gradientLock must be held
+	Colour getColorFromBaked(float time) const; //gradientLock must be held
+
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GradientColorManager)
 };
\ No newline at end of file
@@ -234,21 +234,10 @@ void GradientColorManagerUI::run()
 			return;
 		}
 
-		//manager->gradientLock.enter();
-		for (int tx = 0; tx < resX; tx++)
-		{
-			if (threadShouldExit())
-			{
-				//manager->gradientLock.exit();
-				imageLock.exit();
-				return;
-			}
-
-			Colour col = manager->getColorForPosition(getPosForX(tx));
-			viewImage.setPixelAt(tx, 0, col);
-		}
+		HeapBlock<Colour> colors(resX);
+		manager->fillColours(getPosForX(0), getPosForX(resX - 1), colors, resX);
+		for (int tx = 0; tx < resX; tx++) viewImage.setPixelAt(tx, 0, colors[tx]);
 
-		//manager->gradientLock.exit();
 		imageLock.exit();
 
 		shouldUpdateImage = false;
@@ -92,7 +92,7 @@ void DoubleSliderUI::showEditWindowInternal()
 
 	const String coordNames[2]{ "X","Y" };
 
-	for (int i = 0; i < 2; i++) nameWindow.addTextEditor("val" + String(i), String((float)p2d->value[i]), "Value " + coordNames[i]);
+	for (int i = 0; i < 2; i++) nameWindow.addTextEditor("val" + String(i), String((float)p2d->getValue()[i]), "Value " + coordNames[i]);
 
 	nameWindow.addButton("OK", 1, KeyPress(KeyPress::returnKey));
 	nameWindow.addButton("Cancel", 0, KeyPress(KeyPress::escapeKey));
@@ -224,12 +224,12 @@ void ParameterUI::newMessage(const Parameter::ParameterEvent &e) {
 ParameterUI::ValueEditCalloutComponent::ValueEditCalloutComponent(WeakReference<Parameter> p) :
 	p(p)
 {
-	int numValues = p->isComplex() ? p->value.size() : 1;
+	int numValues = p->isComplex() ? p->getValue().size() : 1;
 	for (int i = 0; i < numValues; i++)
 	{
 		Label* label = new Label("ValueLabel" + String(i));
 		label->addListener(this);
-		label->setText(p->isComplex()?p->value[i].toString():p->stringValue(), dontSendNotification);
+		label->setText(p->isComplex()?p->getValue()[i].toString():p->stringValue(), dontSendNotification);
 		label->setEditable(true);
 		if (p->isComplex()) label->setColour(label->outlineColourId, BG_COLOR);
 		addAndMakeVisible(label);
@@ -246,7 +246,7 @@ ParameterUI::ValueEditCalloutComponent::~ValueEditCalloutComponent()
 void ParameterUI::ValueEditCalloutComponent::resized()
 {
 	const int gap = 4;
-	int numValues = p->isComplex() ? p->value.size() : 1;
+	int numValues = p->isComplex() ? p->getValue().size() : 1;
 	int labelWidth = (getWidth() - (gap * numValues - 1)) / numValues;
 	juce::Rectangle<int> r = getLocalBounds();
 	for (int i = 0; i < numValues; i++)
@@ -269,7 +269,7 @@ void ParameterUI::ValueEditCalloutComponent::labelTextChanged(Label* l)
 		var oldVal = p->getValue();
 
 		var newVal;
-		int numValues = p->isComplex() ? p->value.size() : 1;
+		int numValues = p->isComplex() ? p->getValue().size() : 1;
 		for (int i = 0; i < numValues; i++)
 		{
 			if (p->type == Parameter::STRING) newVal.append(labels[i]->getText());
@@ -111,7 +111,7 @@ void TripleSliderUI::showEditWindowInternal()
 
 	const String coordNames[3]{ "X","Y","Z" };
 
-	for (int i = 0; i < 3; i++) nameWindow.addTextEditor("val" + String(i), String((float)p3d->value[i]), "Value " + coordNames[i]);
+	for (int i = 0; i < 3; i++) nameWindow.addTextEditor("val" + String(i), String((float)p3d->getValue()[i]), "Value " + coordNames[i]);
 
 	nameWindow.addButton("OK", 1, KeyPress(KeyPress::returnKey));
 	nameWindow.addButton("Cancel", 0, KeyPress(KeyPress::escapeKey));
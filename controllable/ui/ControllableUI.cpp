@@ -136,10 +136,10 @@ void ControllableUI::showContextMenu()
 		switch (result)
 		{
 		case -1:
-			SystemClipboard::copyTextToClipboard(controllable->controlAddress);
+			SystemClipboard::copyTextToClipboard(controllable->getControlAddress());
 			break;
 		case -2:
-			SystemClipboard::copyTextToClipboard("root" + controllable->controlAddress.replaceCharacter('/', '.'));
+			SystemClipboard::copyTextToClipboard("root" + controllable->getControlAddress().replaceCharacter('/', '.'));
 			break;
 
 		case -3:
@@ -227,7 +227,7 @@ void ControllableUI::updateTooltip()
 	}
 	else
 	{
-		tooltip = controllable->description + "\nControl Address : " + controllable->controlAddress;
+		tooltip = controllable->description + "\nControl Address : " + controllable->getControlAddress();
 		if (controllable->type != Controllable::Type::TRIGGER) tooltip += " (" + controllable->argumentsDescription + ")";
 		if (controllable->isControllableFeedbackOnly) tooltip += " (read only)";
 	}
@@ -145,6 +145,7 @@ void GenericControllableContainerEditor::showContextMenu()
 	{
 		p.addItem(2, "Copy");
 		p.addItem(3, "Paste (replace data)");
+		p.addItem(4, "Paste values", ControllableClipboard::getInstance()->canPasteValuesTo(container.get()));
 	}
 
 	addPopupMenuItems(&p);
@@ -176,11 +177,15 @@ void GenericControllableContainerEditor::showContextMenu()
 			break;
 
 		case 2:
-			SystemClipboard::copyTextToClipboard(JSON::toString(container->getJSONData()));
+			ControllableClipboard::getInstance()->copy(container->getJSONData(), container.get());
 			break;
 		
 		case 3:
-			container->loadJSONData(JSON::fromString(SystemClipboard::getTextFromClipboard()));
+			container->loadJSONData(ControllableClipboard::getInstance()->getData());
+			break;
+
+		case 4:
+			ControllableClipboard::getInstance()->pasteValuesTo(container.get());
 			break;
 
 		case -1000:
@@ -17,6 +17,7 @@ DashboardItemManagerUI::DashboardItemManagerUI(DashboardItemManager * manager) :
 
 	enableSnapping = DashboardManager::getInstance()->snapping->boolValue();
 	updatePositionOnDragMove = true;
+	setUseSpatialIndex(true);
 
 	setShowAddButton(false);
 
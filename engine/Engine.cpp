@@ -69,7 +69,12 @@ Engine::~Engine() {
 	CustomLogger::deleteInstance();
 	
 	ControllableFactory::deleteInstance();
+	ControllableChooserCache::deleteInstance();
+	ControllableClipboard::deleteInstance();
+	TargetParameterResolver::deleteInstance();
+	FileWatcher::deleteInstance();
 	ScriptUtil::deleteInstance();
+	ScriptWatchdog::deleteInstance();
 	ShapeShifterFactory::deleteInstance();
 	HelpBox::deleteInstance();
 	UndoMaster::deleteInstance();
@@ -0,0 +1,465 @@
+/*
+  ==============================================================================
+
+    EngineBenchmark.cpp
+    Created: 18 Oct 2026 9:21:22pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+#if JUCE_LINUX
+#include <malloc.h>
+#elif JUCE_MAC
+#include <malloc/malloc.h>
+#elif JUCE_WINDOWS
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+EngineBenchmark::EngineBenchmark(int numContainers, int numParametersPerContainer, int numIterations) :
+	numContainers(jmax(numContainers, 1)),
+	numParametersPerContainer(jmax(numParametersPerContainer, 1)),
+	numIterations(jmax(numIterations, 1)),
+	numAutomationKeys(200),
+	numScripts(4),
+	numContainersPerDashboard(10)
+{
+}
+
+EngineBenchmark::~EngineBenchmark()
+{
+	clearSession();
+}
+
+void EngineBenchmark::setupFromCommandLine(const StringArray& args)
+{
+	//args : [containers] [parametersPerContainer] [iterations] [outputFile], numbers are optional
+	if (args.size() > 0 && args[0].containsOnly("0123456789")) numContainers = jmax(args[0].getIntValue(), 1);
+	if (args.size() > 1 && args[1].containsOnly("0123456789")) numParametersPerContainer = jmax(args[1].getIntValue(), 1);
+	if (args.size() > 2 && args[2].containsOnly("0123456789")) numIterations = jmax(args[2].getIntValue(), 1);
+}
+
+var EngineBenchmark::run()
+{
+	results = var(new DynamicObject());
+
+	var config(new DynamicObject());
+	config.getDynamicObject()->setProperty("containers", numContainers);
+	config.getDynamicObject()->setProperty("parametersPerContainer", numParametersPerContainer);
+	config.getDynamicObject()->setProperty("iterations", numIterations);
+	config.getDynamicObject()->setProperty("automations", numContainers / 10 + 1);
+	config.getDynamicObject()->setProperty("automationKeys", numAutomationKeys);
+	config.getDynamicObject()->setProperty("scripts", numScripts);
+	config.getDynamicObject()->setProperty("dashboards", (numContainers + numContainersPerDashboard - 1) / numContainersPerDashboard);
+	results.getDynamicObject()->setProperty("config", config);
+	results.getDynamicObject()->setProperty("benchmarks", var());
+
+	double buildStart = Time::getMillisecondCounterHiRes();
+	buildSession();
+	addResult("build", Array<double>(Time::getMillisecondCounterHiRes() - buildStart), numContainers * numParametersPerContainer);
+
+	benchmarkSave();
+	benchmarkLoad();
+	benchmarkAddressLookup();
+	benchmarkOSCIngest();
+	benchmarkAutomationPlayback();
+	benchmarkScriptUpdate();
+
+	clearSession();
+
+	benchmarkMemory();
+
+	return results;
+}
+
+void EngineBenchmark::buildSession()
+{
+	clearSession();
+
+	root.reset(new ControllableContainer("Benchmark"));
+
+	Random rnd(numContainers * numParametersPerContainer);
+	for (int i = 0; i < numContainers; i++)
+	{
+		ControllableContainer* cc = new ControllableContainer("Container " + String(i + 1));
+		for (int j = 0; j < numParametersPerContainer; j++)
+		{
+			String pName = "Param " + String(j + 1);
+			switch (j % 5)
+			{
+			case 0: cc->addFloatParameter(pName, "Benchmark parameter", rnd.nextFloat(), 0, 1); break;
+			case 1: cc->addIntParameter(pName, "Benchmark parameter", rnd.nextInt(100), 0, 100); break;
+			case 2: cc->addBoolParameter(pName, "Benchmark parameter", rnd.nextBool()); break;
+			case 3: cc->addPoint2DParameter(pName, "Benchmark parameter"); break;
+			case 4: cc->addColorParameter(pName, "Benchmark parameter", Colour(rnd.nextInt())); break;
+			}
+		}
+
+		root->addChildControllableContainer(cc, true, -1, false);
+		for (auto& c : cc->controllables) addresses.add(c->getControlAddress(root.get()));
+	}
+
+	int numAutomations = numContainers / 10 + 1;
+	for (int i = 0; i < numAutomations; i++)
+	{
+		Automation* a = automations.add(new Automation("Automation " + String(i + 1)));
+		a->length->setValue(numAutomationKeys);
+		for (int k = 0; k < numAutomationKeys; k++) a->addKey(k, rnd.nextFloat());
+		root->addChildControllableContainer(a, false, -1, false);
+	}
+
+	//scripts only call their own benchmark function so they don't start the update thread
+	File scriptFolder = File::getSpecialLocation(File::tempDirectory).getChildFile("OrganicBenchmark");
+	scriptFolder.createDirectory();
+
+	for (int i = 0; i < numScripts; i++)
+	{
+		File f = scriptFolder.getChildFile("benchmark" + String(i + 1) + ".js");
+		f.replaceWithText(
+			"var acc = 0;\n"
+			"var p;\n"
+			"function init() { p = script.addFloatParameter(\"Value\", \"Benchmark value\", 0, 0, 1); }\n"
+			"function benchmarkUpdate(dt)\n"
+			"{\n"
+			"\tfor (var i = 0; i < 100; i++) acc += Math.sin(i * dt);\n"
+			"\tp.set(Math.abs(Math.sin(acc)));\n"
+			"\treturn acc;\n"
+			"}\n");
+		scriptFiles.add(f);
+
+		Script* s = scripts.add(new Script());
+		s->filePath->setValue(f.getFullPathName());
+	}
+
+	root->notifyStructureChanged();
+
+	if (Engine::mainEngine == nullptr) return;
+
+	//reachable from the engine, so the dashboard items can resolve their targets when the session is loaded
+	Engine::mainEngine->addChildControllableContainer(root.get(), false, -1, false);
+
+	Dashboard* d = nullptr;
+	for (int i = 0; i < numContainers; i++)
+	{
+		if (i % numContainersPerDashboard == 0) d = DashboardManager::getInstance()->addItem(nullptr, var(), false);
+		for (auto& c : root->controllableContainers[i]->controllables) d->itemManager.addItem(c->createDashboardItem(), var(), false);
+	}
+
+	sessionData = Engine::mainEngine->getJSONData();
+}
+
+void EngineBenchmark::clearSession()
+{
+	if (Engine::mainEngine != nullptr && root != nullptr)
+	{
+		DashboardManager::getInstance()->clear();
+		Engine::mainEngine->removeChildControllableContainer(root.get());
+	}
+	sessionData = var();
+
+	for (auto& a : automations) if (root != nullptr) root->removeChildControllableContainer(a);
+	scripts.clear();
+	automations.clear();
+	root.reset();
+	addresses.clear();
+
+	for (auto& f : scriptFiles) f.deleteFile();
+	scriptFiles.clear();
+}
+
+void EngineBenchmark::loadSession(var data)
+{
+	//same sequence as Engine::loadDocument without the file : targets are queued while loading and resolved when it ends
+	Engine* e = Engine::mainEngine;
+	e->isLoadingFile = true;
+	e->engineListeners.call(&EngineListener::startLoadFile);
+
+	ProgressTask task("Benchmark");
+	e->loadJSONData(data, &task);
+	e->handleAsyncUpdate();
+}
+
+int EngineBenchmark::getNumResolvedDashboardItems()
+{
+	int result = 0;
+	for (auto& d : DashboardManager::getInstance()->items)
+	{
+		for (auto& i : d->itemManager.items)
+		{
+			DashboardControllableItem* ci = dynamic_cast<DashboardControllableItem*>(i);
+			if (ci != nullptr && ci->controllable != nullptr) result++;
+		}
+	}
+
+	return result;
+}
+
+void EngineBenchmark::benchmarkSave()
+{
+	if (Engine::mainEngine == nullptr)
+	{
+		NLOG("Benchmark", "save : no engine to save");
+		return;
+	}
+
+	Array<double> times;
+	int64 size = 0;
+	for (int i = 0; i < numIterations; i++)
+	{
+		double t = Time::getMillisecondCounterHiRes();
+		String s = JSON::toString(Engine::mainEngine->getJSONData(), true);
+		times.add(Time::getMillisecondCounterHiRes() - t);
+		size = s.getNumBytesAsUTF8();
+	}
+
+	var r = addResult("save", times, addresses.size());
+	if (r.isObject()) r.getDynamicObject()->setProperty("bytes", size);
+}
+
+void EngineBenchmark::benchmarkLoad()
+{
+	if (sessionData.isVoid())
+	{
+		NLOG("Benchmark", "load : no engine to load");
+		return;
+	}
+
+	//parsing is part of loading a file, one dashboard item per parameter is recreated and resolved each time
+	String s = JSON::toString(sessionData, true);
+
+	Array<double> times;
+	for (int i = 0; i < numIterations; i++)
+	{
+		double t = Time::getMillisecondCounterHiRes();
+		loadSession(JSON::parse(s));
+		times.add(Time::getMillisecondCounterHiRes() - t);
+	}
+
+	int numResolved = getNumResolvedDashboardItems();
+	if (numResolved != addresses.size()) LOGWARNING("Benchmark : only " << numResolved << " of " << addresses.size() << " dashboard items resolved");
+
+	var r = addResult("load", times, addresses.size());
+	if (r.isObject()) r.getDynamicObject()->setProperty("resolvedItems", numResolved);
+}
+
+void EngineBenchmark::benchmarkAddressLookup()
+{
+	Array<double> times;
+	int numFound = 0;
+	for (int i = 0; i < numIterations; i++)
+	{
+		numFound = 0;
+		double t = Time::getMillisecondCounterHiRes();
+		for (auto& a : addresses) if (root->getControllableForAddress(a) != nullptr) numFound++;
+		times.add(Time::getMillisecondCounterHiRes() - t);
+	}
+
+	if (numFound != addresses.size()) LOGWARNING("Benchmark : only " << numFound << " of " << addresses.size() << " addresses resolved");
+	addResult("addressLookup", times, addresses.size());
+}
+
+void EngineBenchmark::benchmarkOSCIngest()
+{
+	Array<OSCMessage> messages;
+	Random rnd(addresses.size());
+	for (auto& a : addresses)
+	{
+		Controllable* c = root->getControllableForAddress(a);
+		if (c == nullptr || c->type != Controllable::FLOAT) continue;
+		OSCMessage m(a);
+		m.addFloat32(rnd.nextFloat());
+		messages.add(m);
+	}
+
+	Array<double> times;
+	for (int i = 0; i < numIterations; i++)
+	{
+		double t = Time::getMillisecondCounterHiRes();
+		for (auto& m : messages) OSCHelpers::findControllableAndHandleMessage(root.get(), m);
+		times.add(Time::getMillisecondCounterHiRes() - t);
+	}
+
+	addResult("oscIngest", times, messages.size());
+}
+
+void EngineBenchmark::benchmarkAutomationPlayback()
+{
+	const int numSteps = 10000;
+
+	Array<double> times;
+	for (int i = 0; i < numIterations; i++)
+	{
+		double t = Time::getMillisecondCounterHiRes();
+		for (auto& a : automations)
+		{
+			float l = a->length->floatValue();
+			for (int s = 0; s < numSteps; s++) a->position->setValue(s * l / numSteps);
+		}
+		times.add(Time::getMillisecondCounterHiRes() - t);
+	}
+
+	addResult("automationPlayback", times, automations.size() * numSteps);
+}
+
+void EngineBenchmark::benchmarkScriptUpdate()
+{
+	const int numCalls = 1000;
+	static const Identifier benchmarkUpdateId("benchmarkUpdate");
+
+	Array<double> times;
+	for (int i = 0; i < numIterations; i++)
+	{
+		double t = Time::getMillisecondCounterHiRes();
+		for (auto& s : scripts)
+		{
+			if (s->state != Script::SCRIPT_LOADED) continue;
+			for (int c = 0; c < numCalls; c++) s->callFunction(benchmarkUpdateId, Array<var>(.02));
+		}
+		times.add(Time::getMillisecondCounterHiRes() - t);
+	}
+
+	addResult("scriptUpdate", times, scripts.size() * numCalls);
+}
+
+void EngineBenchmark::benchmarkMemory()
+{
+	//heap growth per parameter, parameters share the same description and names like in a real session
+	const int numParameters = jmax(numContainers * numParametersPerContainer, 1000);
+
+	if (getHeapUsage() < 0)
+	{
+		NLOG("Benchmark", "memory : heap usage not available on this platform");
+		return;
+	}
+
+	double t = Time::getMillisecondCounterHiRes();
+
+	//baseline : every parameter owns its strings and its full address, as they did before the pool and lazy addresses
+	Controllable::usePooledStrings = false;
+	int64 baselineBytes = measureParametersMemory(numParameters, true);
+	Controllable::usePooledStrings = true;
+
+	int64 bytes = measureParametersMemory(numParameters, false);
+
+	var r = addResult("memory", Array<double>(Time::getMillisecondCounterHiRes() - t), numParameters);
+	if (r.isObject())
+	{
+		r.getDynamicObject()->setProperty("bytes", bytes);
+		r.getDynamicObject()->setProperty("bytesPerParameter", (double)bytes / numParameters);
+		r.getDynamicObject()->setProperty("baselineBytes", baselineBytes);
+		r.getDynamicObject()->setProperty("baselineBytesPerParameter", (double)baselineBytes / numParameters);
+		r.getDynamicObject()->setProperty("reductionPercent", baselineBytes > 0 ? (1 - (double)bytes / baselineBytes) * 100 : 0);
+	}
+}
+
+int64 EngineBenchmark::measureParametersMemory(int numParameters, bool resolveAddresses)
+{
+	int64 before = getHeapUsage();
+
+	OwnedArray<ControllableContainer> containers;
+	const int numContainersToCreate = numParameters / 100 + 1;
+	containers.ensureStorageAllocated(numContainersToCreate);
+	for (int i = 0; i < numContainersToCreate; i++)
+	{
+		ControllableContainer* cc = containers.add(new ControllableContainer("Container " + String(i + 1)));
+		cc->controllables.ensureStorageAllocated(100);
+	}
+
+	int64 containersBytes = getHeapUsage() - before;
+
+	for (int i = 0; i < numParameters; i++)
+	{
+		FloatParameter* p = containers[i / 100]->addFloatParameter("Param " + String(i % 100), "Benchmark parameter", 0, 0, 1);
+		if (resolveAddresses) p->getControlAddress();
+	}
+
+	return getHeapUsage() - before - containersBytes;
+}
+
+int64 EngineBenchmark::getHeapUsage()
+{
+#if JUCE_LINUX && defined(__GLIBC__)
+#if __GLIBC_PREREQ(2, 33)
+	struct mallinfo2 mi = mallinfo2();
+	return (int64)mi.uordblks + (int64)mi.hblkhd;
+#else
+	struct mallinfo mi = mallinfo();
+	return (int64)mi.uordblks + (int64)mi.hblkhd;
+#endif
+#elif JUCE_MAC
+	malloc_statistics_t stats;
+	malloc_zone_statistics(nullptr, &stats);
+	return (int64)stats.size_in_use;
+#elif JUCE_WINDOWS
+	PROCESS_MEMORY_COUNTERS counters;
+	if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return (int64)counters.PagefileUsage;
+	return -1;
+#else
+	return -1;
+#endif
+}
+
+var EngineBenchmark::addResult(const String& name, const Array<double>& timesMs, int numOperations)
+{
+	if (timesMs.isEmpty()) return var();
+
+	Array<double> sorted(timesMs);
+	sorted.sort();
+
+	double total = 0;
+	for (auto& t : sorted) total += t;
+	double avg = total / sorted.size();
+
+	var r(new DynamicObject());
+	r.getDynamicObject()->setProperty("name", name);
+	r.getDynamicObject()->setProperty("iterations", sorted.size());
+	r.getDynamicObject()->setProperty("operations", numOperations);
+	r.getDynamicObject()->setProperty("minMs", sorted.getFirst());
+	r.getDynamicObject()->setProperty("maxMs", sorted.getLast());
+	r.getDynamicObject()->setProperty("avgMs", avg);
+	r.getDynamicObject()->setProperty("medianMs", sorted[sorted.size() / 2]);
+	r.getDynamicObject()->setProperty("opsPerSecond", avg > 0 ? numOperations * 1000.0 / avg : 0);
+
+	var b = results["benchmarks"];
+	b.append(r);
+	results.getDynamicObject()->setProperty("benchmarks", b);
+
+	NLOG("Benchmark", name << " : " << String(avg, 3) << " ms avg (" << numOperations << " operations)");
+
+	return r;
+}
+
+bool EngineBenchmark::isBenchmarkRequested(const String& commandLine)
+{
+	return !StringUtil::parseCommandLine(commandLine).getCommandLineElement("benchmark").isEmpty();
+}
+
+int EngineBenchmark::runFromCommandLine(const String& commandLine)
+{
+	CommandLineElement e = StringUtil::parseCommandLine(commandLine).getCommandLineElement("benchmark");
+
+	EngineBenchmark b;
+	b.setupFromCommandLine(e.args);
+	var r = b.run();
+
+	String s = JSON::toString(r);
+	String outPath = e.args.size() > 0 ? e.args[e.args.size() - 1] : String();
+
+	if (outPath.isNotEmpty() && !outPath.containsOnly("0123456789"))
+	{
+		File f = File::isAbsolutePath(outPath) ? File(outPath) : File::getCurrentWorkingDirectory().getChildFile(outPath);
+		if (!f.replaceWithText(s))
+		{
+			LOGERROR("Benchmark : could not write results to " << f.getFullPathName());
+			return 1;
+		}
+		LOG("Benchmark results written to " << f.getFullPathName());
+	}
+	else
+	{
+		std::cout << s << std::endl;
+	}
+
+	return 0;
+}
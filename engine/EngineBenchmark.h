@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    EngineBenchmark.h
+    Created: 18 Oct 2026 9:21:22pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class Automation;
+class Script;
+
+/*
+Headless benchmark harness, run with "-benchmark [containers] [parametersPerContainer] [iterations] [outputFile]".
+Builds a synthetic session in the main engine and times the hot paths, results are written as JSON.
+The parameter tree is attached to the engine, and each of its parameters gets a dashboard item targeting it,
+so saving and loading go through Engine::getJSONData / loadJSONData with manager item creation and target resolution.
+*/
+class EngineBenchmark
+{
+public:
+	EngineBenchmark(int numContainers = 100, int numParametersPerContainer = 20, int numIterations = 10);
+	~EngineBenchmark();
+
+	int numContainers;
+	int numParametersPerContainer;
+	int numIterations;
+	int numAutomationKeys;
+	int numScripts;
+	int numContainersPerDashboard;
+
+	std::unique_ptr<ControllableContainer> root;
+	OwnedArray<Automation> automations;
+	OwnedArray<Script> scripts;
+	Array<File> scriptFiles;
+
+	StringArray addresses;
+	var sessionData;
+	var results;
+
+	void setupFromCommandLine(const StringArray& args);
+
+	var run();
+
+	void buildSession();
+	void clearSession();
+	void loadSession(var data);
+	int getNumResolvedDashboardItems();
+
+	void benchmarkSave();
+	void benchmarkLoad();
+	void benchmarkAddressLookup();
+	void benchmarkOSCIngest();
+	void benchmarkAutomationPlayback();
+	void benchmarkScriptUpdate();
+	void benchmarkMemory();
+	int64 measureParametersMemory(int numParameters, bool resolveAddresses); //heap bytes taken by the parameters
+
+	var addResult(const String& name, const Array<double>& timesMs, int numOperations = 1);
+
+	static int64 getHeapUsage(); //bytes allocated by the process, -1 if not available
+
+	static bool isBenchmarkRequested(const String& commandLine);
+	static int runFromCommandLine(const String& commandLine);
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EngineBenchmark)
+};
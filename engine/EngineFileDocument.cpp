@@ -129,6 +129,8 @@ void Engine::fileLoaderEnded() {
 void Engine::handleAsyncUpdate()
 {
 	isLoadingFile = false;
+	TargetParameterResolver::getInstance()->resolvePending(); //targets set while loading, before anyone is told the file is loaded
+
 	if (getFile().exists()) {
 		setLastDocumentOpened(getFile());
 	}
@@ -0,0 +1,375 @@
+/*
+  ==============================================================================
+
+    FileWatcher.cpp
+    Created: 18 Oct 2026 9:37:40pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+#if JUCE_LINUX
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+juce_ImplementSingleton(FileWatcher)
+
+FileWatcher::FileWatcher() :
+	Thread("File Watcher"),
+	debounceMs(50),
+	pollIntervalMs(500),
+	inotifyFD(-1),
+	wakeFD(-1)
+{
+#if JUCE_LINUX
+	inotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (inotifyFD >= 0)
+	{
+		wakeFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (wakeFD < 0)
+		{
+			//without a way to wake the thread up, it could not be stopped
+			close(inotifyFD);
+			inotifyFD = -1;
+		}
+	}
+
+	if (inotifyFD < 0) DBG("File Watcher : inotify not available, falling back to polling");
+#endif
+}
+
+FileWatcher::~FileWatcher()
+{
+	cancelPendingUpdate();
+	signalThreadShouldExit();
+	wakeUp();
+	stopThread(1000);
+
+#if JUCE_LINUX
+	if (inotifyFD >= 0) close(inotifyFD);
+	if (wakeFD >= 0) close(wakeFD);
+#endif
+}
+
+void FileWatcher::addWatch(const File& f, Listener* listener)
+{
+	if (f == File() || listener == nullptr) return;
+
+	{
+		GenericScopedLock<CriticalSection> lock(watchLock);
+
+		Watch* w = getWatchForFile(f);
+		if (w == nullptr)
+		{
+			w = watches.add(new Watch(f));
+			addDirectoryWatch(f.getParentDirectory());
+		}
+
+		w->listeners.addIfNotAlreadyThere(listener);
+	}
+
+	if (!isThreadRunning()) startThread();
+	else wakeUp(); //the directory may need polling, which a sleeping native thread would not do
+}
+
+void FileWatcher::removeWatch(const File& f, Listener* listener)
+{
+	GenericScopedLock<CriticalSection> lock(watchLock);
+
+	Watch* w = getWatchForFile(f);
+	if (w == nullptr) return;
+
+	w->listeners.removeAllInstancesOf(listener);
+	if (w->listeners.isEmpty())
+	{
+		removeDirectoryWatch(w->file.getParentDirectory());
+		watches.removeObject(w);
+	}
+}
+
+void FileWatcher::removeAllWatches(Listener* listener)
+{
+	GenericScopedLock<CriticalSection> lock(watchLock);
+
+	for (int i = watches.size() - 1; i >= 0; i--)
+	{
+		Watch* w = watches[i];
+		w->listeners.removeAllInstancesOf(listener);
+		if (w->listeners.isEmpty())
+		{
+			removeDirectoryWatch(w->file.getParentDirectory());
+			watches.remove(i);
+		}
+	}
+}
+
+FileWatcher::Watch* FileWatcher::getWatchForFile(const File& f)
+{
+	for (auto& w : watches) if (w->file == f) return w;
+	return nullptr;
+}
+
+void FileWatcher::wakeUp()
+{
+#if JUCE_LINUX
+	if (wakeFD >= 0)
+	{
+		uint64_t v = 1;
+		ssize_t written = write(wakeFD, &v, sizeof(v));
+		ignoreUnused(written);
+		return;
+	}
+#endif
+	notify();
+}
+
+void FileWatcher::addDirectoryWatch(const File& dir)
+{
+	//directories are watched instead of files so editors saving through a temp file and a rename are detected
+	for (auto& d : directories)
+	{
+		if (d.directory == dir)
+		{
+			d.numWatches++;
+			return;
+		}
+	}
+
+	WatchedDirectory d{ dir, -1, 1 };
+#if JUCE_LINUX
+	if (inotifyFD >= 0)
+	{
+		d.descriptor = inotify_add_watch(inotifyFD, dir.getFullPathName().toRawUTF8(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MOVED_FROM);
+		if (d.descriptor < 0) DBG("File Watcher : could not watch " << dir.getFullPathName() << ", polling it instead");
+	}
+#endif
+	directories.add(d);
+}
+
+void FileWatcher::removeDirectoryWatch(const File& dir)
+{
+	for (int i = 0; i < directories.size(); i++)
+	{
+		WatchedDirectory& d = directories.getReference(i);
+		if (d.directory != dir) continue;
+
+		if (--d.numWatches > 0) return;
+
+#if JUCE_LINUX
+		if (inotifyFD >= 0 && d.descriptor >= 0) inotify_rm_watch(inotifyFD, d.descriptor);
+#endif
+		directories.remove(i);
+		return;
+	}
+}
+
+bool FileWatcher::isDirectoryWatchedNatively(const File& dir)
+{
+	for (auto& d : directories) if (d.directory == dir) return d.descriptor >= 0;
+	return false;
+}
+
+bool FileWatcher::hasDirectoriesToPoll()
+{
+	GenericScopedLock<CriticalSection> lock(watchLock);
+	for (auto& d : directories) if (d.descriptor < 0) return true;
+	return false;
+}
+
+void FileWatcher::addPendingChange(const File& f)
+{
+	double deadline = Time::getMillisecondCounterHiRes() + debounceMs;
+	for (auto& p : pendingChanges)
+	{
+		if (p.file == f)
+		{
+			p.deadline = deadline; //still being written, wait a bit more
+			return;
+		}
+	}
+
+	pendingChanges.add({ f, deadline });
+}
+
+int FileWatcher::processPendingChanges()
+{
+	if (pendingChanges.isEmpty()) return -1;
+
+	double now = Time::getMillisecondCounterHiRes();
+	double nextDeadline = -1;
+	bool hasChanges = false;
+
+	for (int i = pendingChanges.size() - 1; i >= 0; i--)
+	{
+		const PendingChange& p = pendingChanges.getReference(i);
+		if (p.deadline > now)
+		{
+			if (nextDeadline < 0 || p.deadline < nextDeadline) nextDeadline = p.deadline;
+			continue;
+		}
+
+		Time t = p.file.getLastModificationTime();
+
+		{
+			GenericScopedLock<CriticalSection> lock(watchLock);
+			if (Watch* w = getWatchForFile(p.file))
+			{
+				if (t != w->lastModificationTime)
+				{
+					w->lastModificationTime = t;
+					changedFiles.addIfNotAlreadyThere(p.file);
+					hasChanges = true;
+				}
+			}
+		}
+
+		pendingChanges.remove(i);
+	}
+
+	if (hasChanges) triggerAsyncUpdate();
+
+	return nextDeadline < 0 ? -1 : jmax(1, (int)(nextDeadline - now));
+}
+
+void FileWatcher::run()
+{
+	if (inotifyFD >= 0) runNative();
+	else runPolling();
+}
+
+void FileWatcher::runNative()
+{
+#if JUCE_LINUX
+	alignas(inotify_event) char buffer[4096];
+	double lastPollTime = 0;
+
+	while (!threadShouldExit())
+	{
+		//directories inotify refused (watch limit reached, permissions...) are polled instead
+		int timeout = -1;
+		if (hasDirectoriesToPoll())
+		{
+			double now = Time::getMillisecondCounterHiRes();
+			if (now - lastPollTime >= pollIntervalMs)
+			{
+				pollModificationTimes(true);
+				lastPollTime = now;
+			}
+
+			timeout = jmax(1, (int)(lastPollTime + pollIntervalMs - now));
+		}
+
+		int nextDeadline = processPendingChanges();
+		if (nextDeadline >= 0) timeout = timeout >= 0 ? jmin(timeout, nextDeadline) : nextDeadline;
+
+		//sleeps until something happens on disk, a debounce deadline, a poll or a wake up
+		pollfd pfds[2] = { { inotifyFD, POLLIN, 0 }, { wakeFD, POLLIN, 0 } };
+		int result = poll(pfds, 2, timeout);
+		if (result <= 0) continue;
+
+		if (pfds[1].revents & POLLIN)
+		{
+			uint64_t v;
+			ssize_t r = read(wakeFD, &v, sizeof(v));
+			ignoreUnused(r);
+		}
+
+		if ((pfds[0].revents & POLLIN) == 0) continue;
+
+		bool overflowed = false;
+		ssize_t length;
+		while ((length = read(inotifyFD, buffer, sizeof(buffer))) > 0)
+		{
+			for (char* ptr = buffer; ptr < buffer + length;)
+			{
+				const inotify_event* e = (const inotify_event*)ptr;
+				ptr += sizeof(inotify_event) + e->len;
+
+				//events were dropped, the modification times tell which files changed
+				if (e->mask & IN_Q_OVERFLOW) overflowed = true;
+				if (e->len == 0) continue;
+
+				File f;
+				{
+					GenericScopedLock<CriticalSection> lock(watchLock);
+					for (auto& d : directories)
+					{
+						if (d.descriptor != e->wd) continue;
+						File cf = d.directory.getChildFile(String::fromUTF8(e->name));
+						if (getWatchForFile(cf) != nullptr) f = cf;
+						break;
+					}
+				}
+
+				if (f != File()) addPendingChange(f);
+			}
+		}
+
+		if (overflowed) pollModificationTimes(false);
+	}
+#endif
+}
+
+void FileWatcher::runPolling()
+{
+	while (!threadShouldExit())
+	{
+		pollModificationTimes(false);
+
+		int nextDeadline = processPendingChanges();
+		wait(nextDeadline >= 0 ? jmin(nextDeadline, pollIntervalMs) : pollIntervalMs);
+	}
+}
+
+void FileWatcher::pollModificationTimes(bool onlyNotWatchedNatively)
+{
+	Array<File> files;
+	{
+		GenericScopedLock<CriticalSection> lock(watchLock);
+		for (auto& w : watches)
+		{
+			if (onlyNotWatchedNatively && isDirectoryWatchedNatively(w->file.getParentDirectory())) continue;
+			files.add(w->file);
+		}
+	}
+
+	for (auto& f : files)
+	{
+		Time t = f.getLastModificationTime();
+		GenericScopedLock<CriticalSection> lock(watchLock);
+		if (Watch* w = getWatchForFile(f)) if (t != w->lastModificationTime) addPendingChange(f);
+	}
+}
+
+void FileWatcher::handleAsyncUpdate()
+{
+	Array<File> files;
+	{
+		GenericScopedLock<CriticalSection> lock(watchLock);
+		files.swapWith(changedFiles);
+	}
+
+	for (auto& f : files)
+	{
+		Array<Listener*> listeners;
+		{
+			GenericScopedLock<CriticalSection> lock(watchLock);
+			if (Watch* w = getWatchForFile(f)) listeners = w->listeners;
+		}
+
+		for (auto& l : listeners)
+		{
+			//a listener may remove the others while being notified
+			bool isStillWatching = false;
+			{
+				GenericScopedLock<CriticalSection> lock(watchLock);
+				if (Watch* w = getWatchForFile(f)) isStillWatching = w->listeners.contains(l);
+			}
+
+			if (isStillWatching) l->watchedFileChanged(f);
+		}
+	}
+}
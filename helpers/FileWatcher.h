@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    FileWatcher.h
+    Created: 18 Oct 2026 9:37:40pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//Single watcher thread for all watched files, uses inotify on Linux and polls modification times elsewhere,
+//or for the directories inotify could not watch.
+//Changes are debounced and delivered on the message thread, only when the modification time has changed.
+class FileWatcher :
+	public Thread,
+	public AsyncUpdater
+{
+public:
+	juce_DeclareSingleton(FileWatcher, true);
+
+	FileWatcher();
+	~FileWatcher();
+
+	class Listener
+	{
+	public:
+		virtual ~Listener() {}
+		virtual void watchedFileChanged(const File& f) = 0;
+	};
+
+	class Watch
+	{
+	public:
+		Watch(const File& f) : file(f), lastModificationTime(f.getLastModificationTime()) {}
+		File file;
+		Time lastModificationTime;
+		Array<Listener*> listeners;
+	};
+
+	struct WatchedDirectory
+	{
+		File directory;
+		int descriptor;
+		int numWatches;
+	};
+
+	struct PendingChange
+	{
+		File file;
+		double deadline;
+	};
+
+	int debounceMs;
+	int pollIntervalMs; //used when native notifications are not available, or for directories they could not be set on
+
+	CriticalSection watchLock;
+	OwnedArray<Watch> watches;
+	Array<WatchedDirectory> directories;
+	Array<PendingChange> pendingChanges; //only accessed from the watcher thread
+	Array<File> changedFiles;
+
+	int inotifyFD;
+	int wakeFD; //written to wake the native thread up, it otherwise sleeps until something happens on disk
+
+	void addWatch(const File& f, Listener* listener);
+	void removeWatch(const File& f, Listener* listener);
+	void removeAllWatches(Listener* listener);
+
+	Watch* getWatchForFile(const File& f);
+
+	void wakeUp();
+
+	void addPendingChange(const File& f);
+	int processPendingChanges(); //returns the time until the next deadline, or -1
+
+	void run() override;
+	void runNative();
+	void runPolling();
+	void pollModificationTimes(bool onlyNotWatchedNatively);
+
+	void handleAsyncUpdate() override;
+
+private:
+	void addDirectoryWatch(const File& dir);
+	void removeDirectoryWatch(const File& dir);
+	bool isDirectoryWatchedNatively(const File& dir);
+	bool hasDirectoriesToPoll();
+
+	JUCE_DECLARE_NON_COPYABLE(FileWatcher)
+};
@@ -155,3 +155,34 @@ void OSCHelpers::handleControllableForOSCMessage(Controllable* c, const OSCMessa
 		}
 	}
 }
+
+OSCMessage OSCHelpers::getOSCMessageForControllable(Controllable* c, const String& address)
+{
+	OSCMessage m(address.isNotEmpty() ? address : c->getControlAddress());
+	if (c->type == Controllable::TRIGGER) return m;
+
+	Parameter* p = dynamic_cast<Parameter*>(c);
+	if (p == nullptr) return m;
+
+	var v = p->getValue();
+	if (p->type == Controllable::COLOR) m.addArgument(varToArgument(v)); //4 components array are converted to an OSC colour
+	else if (v.isArray()) for (int i = 0; i < v.size(); i++) m.addArgument(varToArgument(v[i]));
+	else m.addArgument(varToArgument(v));
+
+	return m;
+}
+
+int OSCHelpers::getMessageSize(const OSCMessage& m)
+{
+	//address and type tags are null-terminated and padded to 4 bytes, see OSC 1.0 specification
+	int size = ((m.getAddressPattern().toString().length() + 4) & ~3) + ((m.size() + 5) & ~3);
+
+	for (auto& a : m)
+	{
+		if (a.isString()) size += (a.getString().length() + 4) & ~3;
+		else if (a.isBlob()) size += 4 + ((int)(a.getBlob().getSize() + 3) & ~3);
+		else size += 4;
+	}
+
+	return size;
+}
@@ -22,4 +22,7 @@ public:
 	static Controllable * findControllableAndHandleMessage(ControllableContainer* root, const OSCMessage& m, int dataOffset = 0);
 
 	static void handleControllableForOSCMessage(Controllable* c, const OSCMessage& m, int dataOffset = 0);
+
+	static OSCMessage getOSCMessageForControllable(Controllable* c, const String& address = String());
+	static int getMessageSize(const OSCMessage& m);
 };
@@ -3,112 +3,205 @@
 #pragma once
 
 #include <regex>
+#include <list>
+#include <unordered_map>
 
 class RegexFunctions
 {
 public:
-    
-    static Array<StringArray> findSubstringsThatMatchWildcard(const String &regexWildCard, const String &stringToTest)
+
+    typedef std::shared_ptr<const std::regex> CompiledRegex;
+
+    /** Returns the compiled regex for this pattern, from a bounded cache of the most recently used ones.
+    *    Returns nullptr if the pattern is not valid. */
+    static CompiledRegex getCompiledRegex(const String &wildcard)
+    {
+        static const size_t maxCachedRegexes = 64;
+        static CriticalSection cacheLock;
+        static std::list<std::pair<std::string, CompiledRegex>> cache; //most recently used first
+        static std::unordered_map<std::string, std::list<std::pair<std::string, CompiledRegex>>::iterator> cacheIndex;
+
+        std::string pattern = wildcard.toStdString();
+
+        {
+            GenericScopedLock<CriticalSection> lock(cacheLock);
+            auto it = cacheIndex.find(pattern);
+            if (it != cacheIndex.end())
+            {
+                cache.splice(cache.begin(), cache, it->second);
+                return it->second->second;
+            }
+        }
+
+        CompiledRegex reg;
+        try
+        {
+            reg = std::make_shared<const std::regex>(pattern);
+        }
+        catch (std::regex_error e)
+        {
+            DBG(e.what());
+            return nullptr;
+        }
+
+        GenericScopedLock<CriticalSection> lock(cacheLock);
+        if (cacheIndex.find(pattern) == cacheIndex.end())
+        {
+            cache.emplace_front(pattern, reg);
+            cacheIndex[pattern] = cache.begin();
+
+            if (cache.size() > maxCachedRegexes)
+            {
+                cacheIndex.erase(cache.back().first);
+                cache.pop_back();
+            }
+        }
+
+        return reg;
+    }
+
+    /** Returns all the matches in a single pass. Each entry starts with the whole match, followed by capture groups.
+    *    If stopAtEmptyMatch is true, the search stops at the first match that is an empty string. */
+    static Array<StringArray> findAllMatches(const CompiledRegex &reg, const String &stringToTest, bool stopAtEmptyMatch = false)
     {
         Array<StringArray> matches;
-        String remainingText = stringToTest;
-        StringArray m = getFirstMatch(regexWildCard, remainingText);
+        if (reg == nullptr) return matches;
+
+        std::string s = stringToTest.toStdString();
 
-        while (m.size() != 0 && m[0].length() != 0)
+        //matching can throw as well (error_complexity, error_stack), on long inputs
+        try
         {
-            remainingText = remainingText.fromFirstOccurrenceOf(m[0], false, false);
-            matches.add(m);
-            m = getFirstMatch(regexWildCard, remainingText);
+            std::sregex_iterator it(s.begin(), s.end(), *reg);
+            std::sregex_iterator it_end;
+
+            for (; it != it_end; ++it)
+            {
+                const std::smatch& result = *it;
+                if (stopAtEmptyMatch && result.length(0) == 0) break;
+
+                StringArray m;
+                for (auto& x : result) m.add(String(x.str()));
+                matches.add(m);
+            }
+        }
+        catch (const std::regex_error& e)
+        {
+            DBG(e.what());
+            return Array<StringArray>();
         }
 
         return matches;
     }
 
-    /** Searches a string and returns a StringArray with all matches. 
+    static Array<StringArray> findAllMatches(const String &wildcard, const String &stringToTest, bool stopAtEmptyMatch = false)
+    {
+        return findAllMatches(getCompiledRegex(wildcard), stringToTest, stopAtEmptyMatch);
+    }
+
+    static Array<StringArray> findSubstringsThatMatchWildcard(const String &regexWildCard, const String &stringToTest)
+    {
+        return findAllMatches(regexWildCard, stringToTest, true);
+    }
+
+    /** Searches a string and returns a StringArray with all matches.
     *    You can specify and index of a capture group (if not, the entire match will be used). */
     static StringArray search(const String& wildcard, const String &stringToTest, int indexInMatch=0)
     {
+        StringArray searchResults;
+
+        CompiledRegex reg = getCompiledRegex(wildcard);
+        if (reg == nullptr) return searchResults;
+
+        std::string xAsStd = stringToTest.toStdString();
+
         try
         {
-            StringArray searchResults;
-
-            std::regex includeRegex(wildcard.toStdString());
-            std::string xAsStd = stringToTest.toStdString();
-            std::sregex_iterator it(xAsStd.begin(), xAsStd.end(), includeRegex);
+            std::sregex_iterator it(xAsStd.begin(), xAsStd.end(), *reg);
             std::sregex_iterator it_end;
 
-            while (it != it_end)
+            for (; it != it_end; ++it)
             {
-                std::smatch result = *it;
-
-                StringArray matches;
-                for (auto x : result)
-                {
-                    matches.add(String(x));
-                }
-
-                if (indexInMatch < matches.size()) searchResults.add(matches[indexInMatch]);
-
-                ++it;
+                const std::smatch& result = *it;
+                if (indexInMatch < (int)result.size()) searchResults.add(String(result[indexInMatch].str()));
             }
-
-            return searchResults;
         }
-        catch (std::regex_error e)
+        catch (const std::regex_error& e)
         {
             DBG(e.what());
             return StringArray();
         }
+
+        return searchResults;
     }
 
     /** Returns the first match of the given wildcard in the test string. The first entry will be the whole match, followed by capture groups. */
-    static StringArray getFirstMatch(const String &wildcard, const String &stringToTest)
+    static StringArray getFirstMatch(const CompiledRegex &reg, const String &stringToTest)
     {
+        StringArray sa;
+        if (reg == nullptr) return sa;
+
+        std::string s(stringToTest.toStdString());
+        std::smatch match;
+
         try
         {
-            std::regex reg(wildcard.toStdString());
-            std::string s(stringToTest.toStdString());
-            std::smatch match;
-            
-
-            if (std::regex_search(s, match, reg))
+            if (std::regex_search(s, match, *reg))
             {
-                StringArray sa;
-
-                for (auto x:match)
-                {
-                    sa.add(String(x));
-                }
-                
-                return sa;
+                for (auto& x : match) sa.add(String(x.str()));
             }
-            
-            return StringArray();
         }
-        catch (std::regex_error e)
+        catch (const std::regex_error& e)
         {
-            jassertfalse;
-
             DBG(e.what());
             return StringArray();
         }
+
+        return sa;
+    }
+
+    static StringArray getFirstMatch(const String &wildcard, const String &stringToTest)
+    {
+        CompiledRegex reg = getCompiledRegex(wildcard);
+        jassert(reg != nullptr);
+        return getFirstMatch(reg, stringToTest);
     }
-    
+
     /** Checks if the given string matches the regex wildcard. */
-    static bool matchesWildcard(const String &wildcard, const String &stringToTest)
-    {        
+    static bool matchesWildcard(const CompiledRegex &reg, const String &stringToTest)
+    {
+        if (reg == nullptr) return false;
+
         try
         {
-            std::regex reg(wildcard.toStdString());
-            
-            return std::regex_search(stringToTest.toStdString(), reg);
+            return std::regex_search(stringToTest.toStdString(), *reg);
         }
-        catch (std::regex_error e)
+        catch (const std::regex_error& e)
         {
             DBG(e.what());
-            
             return false;
         }
     }
 
-};
\ No newline at end of file
+    static bool matchesWildcard(const String &wildcard, const String &stringToTest)
+    {
+        return matchesWildcard(getCompiledRegex(wildcard), stringToTest);
+    }
+
+    /** Replaces all matches, the replacement can use $1, $2.. for capture groups. */
+    static String replace(const CompiledRegex &reg, const String &stringToTest, const String &replacement)
+    {
+        if (reg == nullptr) return stringToTest;
+
+        try
+        {
+            return String(std::regex_replace(stringToTest.toStdString(), *reg, replacement.toStdString()));
+        }
+        catch (const std::regex_error& e)
+        {
+            DBG(e.what());
+            return stringToTest;
+        }
+    }
+
+};
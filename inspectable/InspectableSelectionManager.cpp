@@ -44,75 +44,106 @@ void InspectableSelectionManager::selectInspectables(Array<Inspectable*> inspect
 
 	activeSelectionManager = this;
 
-	if (doClearSelection) clearSelection(false);
-	for (auto &i : inspectables) selectInspectable(i, false, false);
-	if (notify)
+	Array<Inspectable *> added;
+	Array<Inspectable *> removed;
+
+	if (doClearSelection)
 	{
-		listeners.call(&Listener::inspectablesSelectionChanged);
-		selectionNotifier.addMessage(new SelectionEvent(SelectionEvent::SELECTION_CHANGED, this));
+		//inspectables that stay selected are not deselected and reselected
+		std::unordered_set<Inspectable *> newSelection(inspectables.begin(), inspectables.end());
+		std::unordered_set<Inspectable *> toRemove;
+		for (auto &i : selectedSet) if (newSelection.count(i) == 0) toRemove.insert(i);
+		removeFromSelection(toRemove, removed);
 	}
 
+	for (auto &i : inspectables) if (addToSelection(i)) added.add(i);
+
+	if (notify && (added.size() > 0 || removed.size() > 0)) notifySelectionChanged(added, removed);
 }
 
 void InspectableSelectionManager::selectInspectable(WeakReference<Inspectable> inspectable, bool doClearSelection, bool notify)
 {
-	if (!enabled) return;
-	if (Engine::mainEngine != nullptr && Engine::mainEngine->isLoadingFile) return;
-
-	activeSelectionManager = this;
+	Array<Inspectable *> inspectables;
+	if (inspectable.get() != nullptr) inspectables.add(inspectable.get());
+	selectInspectables(inspectables, doClearSelection, notify);
+}
 
-	if (doClearSelection) clearSelection(false);
+void InspectableSelectionManager::deselectInspectables(Array<Inspectable*> inspectables, bool notify)
+{
+	std::unordered_set<Inspectable *> toRemove;
+	for (auto &i : inspectables) if (selectedSet.count(i) > 0) toRemove.insert(i);
 
-	if (currentInspectables.contains(inspectable)) return;
+	Array<Inspectable *> removed;
+	removeFromSelection(toRemove, removed);
 
-	if (inspectable.get() != nullptr)
-	{
-		inspectable->setSelected(true);
-		inspectable->addInspectableListener(this);
-		currentInspectables.add(inspectable);
-	}
-
-	if (notify)
-	{
-		listeners.call(&Listener::inspectablesSelectionChanged);
-		selectionNotifier.addMessage(new SelectionEvent(SelectionEvent::SELECTION_CHANGED, this));
-	}
+	if (notify && removed.size() > 0) notifySelectionChanged(Array<Inspectable *>(), removed);
 }
 
 void InspectableSelectionManager::deselectInspectable(WeakReference<Inspectable> inspectable, bool notify)
 {
-	if (!inspectable.wasObjectDeleted())
-	{
-		inspectable->removeInspectableListener(this);
-		inspectable->setSelected(false);
-		currentInspectables.removeAllInstancesOf(inspectable.get());
-	}
-	
-	if(notify)
-	{
-		listeners.call(&Listener::inspectablesSelectionChanged);
-		selectionNotifier.addMessage(new SelectionEvent(SelectionEvent::SELECTION_CHANGED, this));
-	}
+	Array<Inspectable *> inspectables;
+	if (!inspectable.wasObjectDeleted()) inspectables.add(inspectable.get());
+	deselectInspectables(inspectables, notify);
 }
 
 void InspectableSelectionManager::clearSelection(bool notify)
 {
-	while(currentInspectables.size() > 0)
+	Array<Inspectable *> removed;
+	removeFromSelection(selectedSet, removed);
+
+	if (notify) notifySelectionChanged(Array<Inspectable *>(), removed);
+}
+
+bool InspectableSelectionManager::isEmpty()
+{
+	return currentInspectables.size() == 0;
+}
+
+bool InspectableSelectionManager::isInSelection(Inspectable * inspectable) const
+{
+	return selectedSet.count(inspectable) > 0;
+}
+
+bool InspectableSelectionManager::addToSelection(Inspectable * i)
+{
+	if (i == nullptr || selectedSet.count(i) > 0) return false;
+
+	selectedSet.insert(i);
+	currentInspectables.add(i);
+	i->addInspectableListener(this);
+	i->setSelected(true);
+	return true;
+}
+
+void InspectableSelectionManager::removeFromSelection(const std::unordered_set<Inspectable*> &toRemove, Array<Inspectable *> &removed)
+{
+	if (toRemove.empty()) return;
+
+	//single pass over the selection, whatever the number of removed inspectables
+	Array<WeakReference<Inspectable>> remaining;
+	for (auto &i : currentInspectables)
 	{
-		deselectInspectable(currentInspectables[0],false);
+		Inspectable * ii = i.get();
+		if (ii != nullptr && toRemove.count(ii) == 0) remaining.add(i);
+		else if (ii != nullptr) removed.add(ii);
 	}
 
-	currentInspectables.clear();
-	if (notify)
+	currentInspectables.swapWith(remaining);
+	for (auto &i : removed) selectedSet.erase(i);
+
+	//callbacks are called once the selection is consistent, they may change it
+	for (auto &i : removed)
 	{
-		listeners.call(&Listener::inspectablesSelectionChanged);
-		selectionNotifier.addMessage(new SelectionEvent(SelectionEvent::SELECTION_CHANGED, this));
+		i->removeInspectableListener(this);
+		i->setSelected(false);
 	}
 }
 
-bool InspectableSelectionManager::isEmpty()
+void InspectableSelectionManager::notifySelectionChanged(const Array<Inspectable*> &added, const Array<Inspectable*> &removed)
 {
-	return currentInspectables.size() == 0;
+	listeners.call(&Listener::inspectablesSelectionChanged);
+	listeners.call(&Listener::inspectablesSelectionDiff, added, removed);
+	selectionNotifier.addMessage(new SelectionEvent(SelectionEvent::SELECTION_CHANGED, this, added, removed));
 }
 
 void InspectableSelectionManager::inspectableDestroyed(Inspectable * i)
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Inspectable.h"
+#include <unordered_set>
 
 class InspectableSelectionManager :
 	public Inspectable::InspectableListener
@@ -24,7 +25,8 @@ public:
 	static InspectableSelectionManager * activeSelectionManager; //The last one having selected something, useful for key events like delete
 
 	bool enabled;
-	Array<WeakReference<Inspectable>> currentInspectables;
+	Array<WeakReference<Inspectable>> currentInspectables; //in selection order, the inspector shows the first one
+	std::unordered_set<Inspectable *> selectedSet; //same content as currentInspectables, for constant time lookups
 	
 	template<class T>
 	T * getInspectableAs();
@@ -35,11 +37,13 @@ public:
 
 	void selectInspectables(Array<Inspectable *> inspectables, bool clearSelection = true, bool notify = true);
 	void selectInspectable(WeakReference<Inspectable> inspectable, bool clearSelection = true, bool notify = true);
+	void deselectInspectables(Array<Inspectable *> inspectables, bool notify = true);
 	void deselectInspectable(WeakReference<Inspectable> inspectable, bool notify = true);
 
 	void clearSelection(bool notify = true);
 
 	bool isEmpty();
+	bool isInSelection(Inspectable * inspectable) const;
 
 	//From InspectableListener
 	void inspectableDestroyed(Inspectable * inspectable);
@@ -51,6 +55,7 @@ public:
 	public:
 		virtual ~Listener() {}
 		virtual void inspectablesSelectionChanged() {};
+		virtual void inspectablesSelectionDiff(const Array<Inspectable *> &/*added*/, const Array<Inspectable *> &/*removed*/) {}
 	};
 
 	ListenerList<Listener> listeners;
@@ -62,11 +67,17 @@ public:
 	public:
 		enum Type { SELECTION_CHANGED };
 
-		SelectionEvent(Type t, InspectableSelectionManager * ism) :
-			type(t), selectionManager(ism) {}
+		SelectionEvent(Type t, InspectableSelectionManager * ism, const Array<Inspectable *> &added = Array<Inspectable *>(), const Array<Inspectable *> &removed = Array<Inspectable *>()) :
+			type(t), selectionManager(ism)
+		{
+			for (auto &i : added) addedInspectables.add(i);
+			for (auto &i : removed) removedInspectables.add(i);
+		}
 
 		Type type;
 		InspectableSelectionManager * selectionManager;
+		Array<WeakReference<Inspectable>> addedInspectables;
+		Array<WeakReference<Inspectable>> removedInspectables;
 	};
 
 	QueuedNotifier<SelectionEvent> selectionNotifier;
@@ -75,6 +86,11 @@ public:
 	void addAsyncSelectionManagerListener(AsyncListener* newListener) { selectionNotifier.addListener(newListener); }
 	void addAsyncCoalescedSelectionManagerListener(AsyncListener* newListener) { selectionNotifier.addAsyncCoalescedListener(newListener); }
 	void removeAsyncSelectionManagerListener(AsyncListener* listener) { selectionNotifier.removeListener(listener); }
+
+private:
+	bool addToSelection(Inspectable * inspectable);
+	void removeFromSelection(const std::unordered_set<Inspectable *> &toRemove, Array<Inspectable *> &removed);
+	void notifySelectionChanged(const Array<Inspectable *> &added, const Array<Inspectable *> &removed);
 };
 
 
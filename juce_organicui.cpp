@@ -21,6 +21,7 @@
 
 #include "helpers/StringUtil.cpp"
 #include "helpers/OSCHelpers.cpp"
+#include "helpers/FileWatcher.cpp"
 #include "helpers/crypto/hmac/SHA1.cpp"
 #include "helpers/crypto/hmac/HMAC_SHA1.cpp"
 
@@ -28,6 +29,8 @@
 #include "script/ScriptExpression.cpp"
 #include "controllable/Controllable.cpp"
 #include "controllable/ControllableContainer.cpp"
+#include "controllable/ParameterSnapshot.cpp"
+#include "controllable/ControllableClipboard.cpp"
 #include "controllable/ControllableFactory.cpp"
 #include "controllable/ControllableHelpers.cpp"
 #include "controllable/parameter/BoolParameter.cpp"
@@ -43,6 +46,7 @@
 #include "controllable/parameter/StringParameter.cpp"
 #include "controllable/parameter/FileParameter.cpp"
 #include "controllable/parameter/TargetParameter.cpp"
+#include "controllable/parameter/TargetParameterResolver.cpp"
 #include "controllable/parameter/ui/BetterStepper.cpp"
 #include "controllable/parameter/ui/BoolImageToggleUI.cpp"
 #include "controllable/parameter/ui/BoolToggleUI.cpp"
@@ -89,6 +89,7 @@ using namespace juce;
 #include "helpers/WakeOnLan.h"
 #include "helpers/OSCHelpers.h"
 #include "helpers/NetworkHelpers.h"
+#include "helpers/FileWatcher.h"
 
 
 #include "undo/UndoMaster.h"
@@ -145,6 +146,7 @@ using namespace juce;
 #include "controllable/parameter/StringParameter.h"
 #include "controllable/parameter/FileParameter.h"
 #include "controllable/parameter/TargetParameter.h"
+#include "controllable/parameter/TargetParameterResolver.h"
 
 #include "controllable/parameter/ui/BetterStepper.h"
 #include "controllable/parameter/ui/BoolImageToggleUI.h"
@@ -168,10 +170,12 @@ using namespace juce;
 #include "controllable/ui/TriggerButtonUI.h"
 #include "controllable/ui/TriggerImageUI.h"
 
+#include "controllable/ParameterSnapshot.h"
 #include "controllable/ControllableContainer.h"
 #include "controllable/ui/GenericControllableContainerEditor.h"
 
 #include "controllable/ControllableUtil.h"
+#include "controllable/ControllableClipboard.h"
 
 #include "updater/AppUpdater.h"
 
@@ -277,9 +281,12 @@ using namespace juce;
 #include "controllable/parameter/dashboard/DashboardParameterItem.h"
 #include "controllable/parameter/dashboard/ui/DashboardParameterItemUI.h"
 
+#include "script/ScriptProfiler.h"
 #include "script/Script.h"
+#include "script/ScriptWatchdog.h"
 #include "script/ScriptManager.h"
 #include "script/ScriptUtil.h"
+#include "script/ui/ScriptProfilerUI.h"
 #include "script/ui/ScriptEditor.h"
 
 
@@ -293,6 +300,7 @@ using namespace juce;
 #include "app/CrashHandler.h"
 #include "app/OrganicMainComponent.h"
 #include "app/OrganicApplication.h"
+#include "engine/EngineBenchmark.h"
 
 #include "remotecontrol/OSCRemoteControl.h"
 
@@ -46,9 +46,12 @@
 #include "progress/ui/ProgressWindow.cpp"
 
 #include "script/ScriptTarget.cpp"
+#include "script/ScriptProfiler.cpp"
 #include "script/Script.cpp"
+#include "script/ScriptWatchdog.cpp"
 #include "script/ScriptManager.cpp"
 #include "script/ScriptUtil.cpp"
+#include "script/ui/ScriptProfilerUI.cpp"
 #include "script/ui/ScriptEditor.cpp"
 
 #include "ui/AssetManager.cpp"
@@ -75,6 +78,7 @@
 #include "app/OrganicMainComponent.cpp"
 #include "app/OrganicMainComponentCommands.cpp"
 #include "app/OrganicApplication.cpp"
+#include "engine/EngineBenchmark.cpp"
 
 #include "remotecontrol/OSCRemoteControl.cpp"
 
@@ -77,7 +77,7 @@ void BaseItem::copy()
 {
 	var data = getJSONData();
 	data.getDynamicObject()->setProperty("itemType", itemDataType);
-	SystemClipboard::copyTextToClipboard(JSON::toString(data));
+	ControllableClipboard::getInstance()->copy(data);
 	NLOG(niceName, "Copied to clipboard");
 }
 
@@ -151,6 +151,11 @@ void BaseItem::itemAdded(Script* script)
 	script->warningResolveInspectable = this;
 }
 
+void BaseItem::itemsAdded(Array<Script*> scripts)
+{
+	for (auto& s : scripts) s->warningResolveInspectable = this;
+}
+
 var BaseItem::getJSONData()
 {
 	var data = ControllableContainer::getJSONData();
@@ -63,6 +63,7 @@ public:
 	virtual void onControllableFeedbackUpdateInternal(ControllableContainer * cc, Controllable * c) {};
 
 	void itemAdded(Script* script) override;
+	void itemsAdded(Array<Script*> scripts) override;
 
 	var getJSONData() override;
 	void loadJSONDataInternal(var data) override;
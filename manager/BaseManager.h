@@ -48,6 +48,9 @@ public:
 	T * addItem(T * item, const Point<float> initialPosition, bool addToUndo = true, bool notify = true);
 	Array<T *> addItems(Array<T *> items, var data = var(), bool addToUndo = true);
 
+	Array<T *> createItemsFromData(var data, var &createdItemsData); //createdItemsData is kept aligned with the returned items when some entries are skipped
+	void insertItems(Array<T *> itemsToInsert, var data); //bulk insert without notifications, used by addItems and when loading
+
 
 	virtual Array<UndoableAction *> getRemoveItemUndoableAction(T * item);
 	virtual Array<UndoableAction *> getRemoveItemsUndoableAction(Array<T *> items);
@@ -56,7 +59,9 @@ public:
 	void removeItem(T * item, bool addToUndo = true, bool notify = true);
 
 	virtual void setItemIndex(T * item, int newIndex);
+	virtual bool reorderItem(T * item); //moves only this item to its sorted index, when its ordering key changed. Returns true if it moved
 	virtual void reorderItems(); //to be overriden if needed
+	void notifyItemMoved(T * item); //for subclasses moving items in the arrays themselves
 
 
 	//to override for specific handling like adding custom listeners, etc.
@@ -99,7 +104,7 @@ public:
 	class ManagerEvent
 	{
 	public:
-		enum Type { ITEM_ADDED, ITEM_REMOVED, ITEMS_REORDERED, ITEMS_ADDED, ITEMS_REMOVED, MANAGER_CLEARED };
+		enum Type { ITEM_ADDED, ITEM_REMOVED, ITEMS_REORDERED, ITEMS_ADDED, ITEMS_REMOVED, MANAGER_CLEARED, ITEM_MOVED };
 
 		ManagerEvent(Type t, T* i = nullptr);
 		ManagerEvent(Type t, Array<T*> iList);
@@ -131,9 +136,14 @@ public:
 
 		String managerControlAddress;
 		var data;
+		MemoryBlock compressedData; //item data is kept compressed while the action waits in the undo history
 		WeakReference<Inspectable> managerRef;
 
 		BaseManager<T>* getManager();
+
+		void storeData(const var &_data);
+		var getData();
+		int getSizeInUnits() override;
 	};
 
 	class ItemBaseAction :
@@ -366,39 +376,62 @@ T * BaseManager<T>::addItem(T * item, const Point<float> initialPosition, bool a
 template<class T>
 Array<T *> BaseManager<T>::addItems(Array<T *> itemsToAdd, var data, bool addToUndo)
 {
-
-	isCurrentlyLoadingData = true;
-	isManipulatingMultipleItems = true;
-
 	if (addToUndo && !UndoMaster::getInstance()->isPerforming)
 	{
 		AddItemsAction * a = new AddItemsAction(this, itemsToAdd, data);
 		UndoMaster::getInstance()->performAction("Add " + String(itemsToAdd.size()) + " items", a);
-		isCurrentlyLoadingData = false;
-		isManipulatingMultipleItems = false;
 		return itemsToAdd;
 	}
 
+	bool wasLoadingData = isCurrentlyLoadingData; //may already be set if called from loadJSONData
+	isCurrentlyLoadingData = true;
+	isManipulatingMultipleItems = true;
 
-	for (int i = 0; i < itemsToAdd.size(); i++)
-	{
-		addItem(itemsToAdd[i], data.isArray() ? data[i] : var(), false, false);
-	}
-
+	insertItems(itemsToAdd, data);
 	notifyStructureChanged();
 
 	baseManagerListeners.call(&BaseManagerListener<T>::itemsAdded, itemsToAdd);
 	managerNotifier.addMessage(new ManagerEvent(ManagerEvent::ITEMS_ADDED, itemsToAdd));
 
 	reorderItems();
-	isCurrentlyLoadingData = false;
+	isCurrentlyLoadingData = wasLoadingData;
 	isManipulatingMultipleItems = false;
 
 	addItemsInternal(itemsToAdd, data);
 
+	if (selectItemWhenCreated && itemsToAdd.size() > 0) static_cast<BaseItem *>(itemsToAdd.getLast())->selectThis();
+
 	return itemsToAdd;
 }
 
+template<class T>
+void BaseManager<T>::insertItems(Array<T *> itemsToInsert, var data)
+{
+	items.ensureStorageAllocated(items.size() + itemsToInsert.size());
+	controllableContainers.ensureStorageAllocated(controllableContainers.size() + itemsToInsert.size());
+
+	//names are checked against a set built once, instead of rescanning all children for each new item
+	HashSet<String> takenNames;
+	if (Engine::mainEngine != nullptr && !Engine::mainEngine->isLoadingFile) fillTakenNames(takenNames);
+
+	for (int i = 0; i < itemsToInsert.size(); i++)
+	{
+		T * item = itemsToInsert[i];
+		var itemData = data.isArray() ? data[i] : var();
+		BaseItem * bi = static_cast<BaseItem *>(item);
+
+		int targetIndex = itemData.getProperty("index", -1);
+		if (targetIndex < 0 || targetIndex > items.size()) targetIndex = items.size();
+		items.insert(targetIndex, item);
+
+		bi->addBaseItemListener(this);
+		if (!itemData.isVoid()) bi->loadJSONData(itemData);
+
+		addChildControllableContainer(bi, false, targetIndex, false, &takenNames);
+		addItemInternal(item, itemData);
+	}
+}
+
 //if data is not empty, load data
 template<class T>
 T * BaseManager<T>::addItemFromData(var data, bool addToUndo)
@@ -419,32 +452,47 @@ T * BaseManager<T>::addItemFromData(var data, bool addToUndo)
 
 template<class T>
 Array<T*> BaseManager<T>::addItemsFromData(var data, bool addToUndo)
+{
+	var itemsData;
+	Array<T *> itemsToAdd = createItemsFromData(data, itemsData);
+	if (itemsToAdd.size() == 0) return Array<T*>();
+	return addItems(itemsToAdd, itemsData, addToUndo);
+}
+
+template<class T>
+Array<T*> BaseManager<T>::createItemsFromData(var data, var &itemsData)
 {
 	Array<T *> itemsToAdd;
-	if (managerFactory != nullptr)
+	itemsToAdd.ensureStorageAllocated(data.size());
+
+	for (int i = 0; i < data.size(); i++)
 	{
-		for (int i = 0; i < data.size(); i++)
+		T * it = nullptr;
+		if (managerFactory != nullptr)
 		{
 			String type = data[i].getProperty("type", "");
-			if (type.isEmpty()) return nullptr;
-			T * it = managerFactory->create(type);
-			if(it != nullptr) itemsToAdd.add(it);
+			if (type.isEmpty()) continue;
+			it = managerFactory->create(type);
 		}
-	} else
-	{
-		for (int i = 0; i < data.size(); i++)  itemsToAdd.add(createItem());
+		else
+		{
+			it = createItem();
+		}
+
+		if (it == nullptr) continue;
+		itemsToAdd.add(it);
+		itemsData.append(data[i]);
 	}
 
-	return addItems(itemsToAdd, data, addToUndo);
+	return itemsToAdd;
 }
 
 template<class T>
 Array<T *> BaseManager<T>::addItemsFromClipboard(bool showWarning)
 {
 	if (!userCanAddItemsManually) return Array<T*>();
-	String s = SystemClipboard::getTextFromClipboard();
-	var data = JSON::parse(s);
-	if (data.isVoid()) return Array<T*>();
+	var data = ControllableClipboard::getInstance()->getData();
+	if (!data.isObject()) return Array<T*>();
 
 	String t = data.getProperty("itemType", "");
 	if (!canAddItemOfType(t))
@@ -453,8 +501,6 @@ Array<T *> BaseManager<T>::addItemsFromClipboard(bool showWarning)
 		return Array<T *>();
 	}
 
-	int sIndex = items.indexOf(InspectableSelectionManager::activeSelectionManager->getInspectableAs<T>());
-	if(sIndex >= 0) data.getDynamicObject()->setProperty("index", sIndex+1);
 	Array<T *> copiedItems = addItemsFromData(data.getProperty("items",var()));
 
 	for (auto &i : copiedItems)
@@ -573,8 +619,44 @@ void BaseManager<T>::setItemIndex(T * item, int newIndex)
 	controllableContainers.move(index, newIndex);
 	//items.getLock().exit();
 
+	notifyItemMoved(item);
+}
+
+template<class T>
+void BaseManager<T>::notifyItemMoved(T * item)
+{
+	//itemsReordered is still sent for listeners that don't handle single moves, the reordered event carries the moved item so the ones that do can skip it
+	baseManagerListeners.call(&BaseManagerListener<T>::itemMoved, item);
 	baseManagerListeners.call(&BaseManagerListener<T>::itemsReordered);
-	managerNotifier.addMessage(new ManagerEvent(ManagerEvent::ITEMS_REORDERED));
+	managerNotifier.addMessage(new ManagerEvent(ManagerEvent::ITEM_MOVED, item));
+	managerNotifier.addMessage(new ManagerEvent(ManagerEvent::ITEMS_REORDERED, item));
+}
+
+template<class T>
+bool BaseManager<T>::reorderItem(T * item)
+{
+	if (comparator.compareFunc == nullptr) return false;
+
+	int index = items.indexOf(item);
+	if (index == -1) return false;
+
+	int numItems = items.size();
+	if ((index == 0 || comparator.compareElements(items[index - 1], item) <= 0)
+		&& (index == numItems - 1 || comparator.compareElements(item, items[index + 1]) <= 0)) return false; //still in place
+
+	//dichotomy on the other items, which are still sorted
+	int low = 0;
+	int high = numItems - 1;
+	while (low < high)
+	{
+		int mid = (low + high) / 2;
+		T * midItem = items[mid < index ? mid : mid + 1];
+		if (comparator.compareElements(midItem, item) <= 0) low = mid + 1;
+		else high = mid;
+	}
+
+	setItemIndex(item, low);
+	return true;
 }
 
 template<class T>
@@ -676,12 +758,12 @@ void BaseManager<T>::askForMoveAfter(BaseItem * i)
 template<class T>
 void BaseManager<T>::askForSelectAllItems(bool addToSelection)
 {
-	int numItems = items.size();
-	if (!addToSelection) selectionManager->clearSelection(numItems == 0);
-	else deselectThis(numItems == 0);
+	if (addToSelection) deselectThis(items.size() == 0);
 
-	if (numItems > 1) for (int i = 0; i < numItems; i++) items[i]->selectThis(true, i == numItems-1); //only notify on last
-	else if (numItems > 0) items[0]->selectThis(addToSelection, true);
+	//one batched selection change instead of one per item
+	Array<Inspectable *> itemsToSelect;
+	for (auto &i : items) if (i->isSelectable) itemsToSelect.add(i);
+	selectionManager->selectInspectables(itemsToSelect, !addToSelection);
 }
 
 template<class T>
@@ -727,14 +809,25 @@ void BaseManager<T>::loadJSONDataInternal(var data)
 template<class T>
 void BaseManager<T>::loadJSONDataManagerInternal(var data)
 {
-	Array<var> * itemsData = data.getProperty("items", var()).getArray();
-	if (itemsData == nullptr) return;
+	var itemsData = data.getProperty("items", var());
+	if (!itemsData.isArray()) return;
 
-	for (auto &td : *itemsData)
+	var loadedItemsData;
+	Array<T *> loadedItems = createItemsFromData(itemsData, loadedItemsData);
+	if (loadedItems.size() == 0) return;
+
+	//items are inserted in bulk with a single structure change, but still announced one by one like addItem does,
+	//so itemAdded / ITEM_ADDED listeners see loaded items. No addItemsInternal nor reorder, the saved order is kept
+	insertItems(loadedItems, loadedItemsData);
+	notifyStructureChanged();
+
+	for (auto &item : loadedItems)
 	{
-		addItemFromData(td, false);
+		baseManagerListeners.call(&BaseManagerListener<T>::itemAdded, item);
+		managerNotifier.addMessage(new ManagerEvent(ManagerEvent::ITEM_ADDED, item));
 	}
 
+	if (selectItemWhenCreated) static_cast<BaseItem *>(loadedItems.getLast())->selectThis();
 }
 
 template<class T>
@@ -989,9 +1082,29 @@ inline T* BaseManager<T>::ManagerEvent::getItem(int index) const
 template<class T>
 inline BaseManager<T>::ManagerBaseAction::ManagerBaseAction(BaseManager* manager, var _data) :
 	managerControlAddress(manager->getControlAddress()),
-	data(_data),
 	managerRef(manager)
-{}
+{
+	storeData(_data);
+}
+
+template<class T>
+inline void BaseManager<T>::ManagerBaseAction::storeData(const var& _data)
+{
+	compressedData = UndoMaster::compressData(_data);
+	data = var();
+}
+
+template<class T>
+inline var BaseManager<T>::ManagerBaseAction::getData()
+{
+	return compressedData.isEmpty() ? data : UndoMaster::decompressData(compressedData);
+}
+
+template<class T>
+inline int BaseManager<T>::ManagerBaseAction::getSizeInUnits()
+{
+	return (int)sizeof(*this) + (int)compressedData.getSize() + UndoMaster::getVarSize(data);
+}
 
 template<class T>
 inline BaseManager<T>* BaseManager<T>::ManagerBaseAction::getManager() {
@@ -1049,11 +1162,11 @@ inline bool BaseManager<T>::AddItemAction::perform()
 	T* item = this->getItem();
 	if (item != nullptr)
 	{
-		m->addItem(item, this->data, false);
+		m->addItem(item, this->getData(), false);
 	}
 	else
 	{
-		item = m->addItemFromData(this->data, false);
+		item = m->addItemFromData(this->getData(), false);
 	}
 
 	if (item == nullptr) return false;
@@ -1067,8 +1180,9 @@ inline bool BaseManager<T>::AddItemAction::undo()
 {
 	T* s = this->getItem();
 	if (s == nullptr) return false;
-	this->data = s->getJSONData();
-	this->data.getDynamicObject()->setProperty("index", this->itemIndex);
+	var itemData = s->getJSONData();
+	itemData.getDynamicObject()->setProperty("index", this->itemIndex);
+	this->storeData(itemData);
 
 	this->getManager()->removeItem(s, false);
 	this->itemRef = nullptr;
@@ -1087,10 +1201,11 @@ inline bool BaseManager<T>::RemoveItemAction::perform()
 
 	if (s == nullptr) return false;
 
-	this->data = s->getJSONData();
-	if (this->data.getDynamicObject() == nullptr) return false;
+	var itemData = s->getJSONData();
+	if (itemData.getDynamicObject() == nullptr) return false;
 
-	this->data.getDynamicObject()->setProperty("index", this->itemIndex);
+	itemData.getDynamicObject()->setProperty("index", this->itemIndex);
+	this->storeData(itemData);
 
 	this->getManager()->removeItem(s, false);
 	this->itemRef = nullptr;
@@ -1102,7 +1217,7 @@ inline bool BaseManager<T>::RemoveItemAction::undo()
 {
 	BaseManager* m = this->getManager();
 	if (m == nullptr) return false;
-	this->itemRef = m->addItemFromData(this->data, false);
+	this->itemRef = m->addItemFromData(this->getData(), false);
 	return true;
 }
 
@@ -1157,7 +1272,7 @@ inline bool BaseManager<T>::AddItemsAction::perform()
 	if (m == nullptr) return false;
 
 	Array<T*> iList = this->getItems();
-	m->addItems(iList, this->data, false);
+	m->addItems(iList, this->getData(), false);
 
 	this->itemsShortName.clear();
 	for (auto& i : iList) this->itemsShortName.add(i != nullptr ? i->shortName : "");
@@ -1168,8 +1283,9 @@ template<class T>
 inline bool BaseManager<T>::AddItemsAction::undo()
 {
 	Array<T*> iList = this->getItems();
-	this->data = var();
-	for (auto& i : iList) if (i != nullptr) this->data.append(i->getJSONData());
+	var itemsData;
+	for (auto& i : iList) if (i != nullptr) itemsData.append(i->getJSONData());
+	this->storeData(itemsData);
 	BaseManager * m = this->getManager();
 	if (m != nullptr) m->removeItems(iList, false);
 	this->itemsRef.clear();
@@ -1184,8 +1300,9 @@ template<class T>
 inline bool BaseManager<T>::RemoveItemsAction::perform()
 {
 	Array<T*> iList = this->getItems();
-	this->data = var();
-	for (auto& i : iList) if (i != nullptr) this->data.append(i->getJSONData());
+	var itemsData;
+	for (auto& i : iList) if (i != nullptr) itemsData.append(i->getJSONData());
+	this->storeData(itemsData);
 	BaseManager * m = this->getManager();
 	if (m != nullptr) m->removeItems(iList, false);
 	this->itemsRef.clear();
@@ -1198,7 +1315,7 @@ inline bool BaseManager<T>::RemoveItemsAction::undo()
 	BaseManager* m = this->getManager();
 	if (m == nullptr) return false;
 
-	Array<T*> iList = m->addItemsFromData(this->data, false);
+	Array<T*> iList = m->addItemsFromData(this->getData(), false);
 
 	this->itemsShortName.clear();
 	for (auto& i : iList) this->itemsShortName.add(i != nullptr ? i->shortName : "");
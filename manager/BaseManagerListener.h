@@ -11,4 +11,5 @@ public:
 	virtual void itemRemoved(T*) {}
 	virtual void itemsRemoved(Array<T*>) {}
 	virtual void itemsReordered() {}
+	virtual void itemMoved(T*) {}
 };
@@ -112,9 +112,21 @@ public:
 	bool fixedItemHeight;
 	int gap;
 
+	//virtualization : only create UIs for items intersecting the viewport, other items are laid out from their listUISize
+	bool useVirtualizedList;
+	bool isPlacingVirtualizedItems;
+	int virtualizedMargin;
+	int virtualizedItemExtraSize; //header and margins around the listUISize, learned from the created UIs
+	int virtualizedDefaultItemSize; //size for items in mini mode or without listUISize
+	int virtualizedContentSize;
+
 	void setDefaultLayout(Layout l);
 	void addExistingItems(bool resizeAfter = true);
 
+	void setUseVirtualizedList(bool value);
+	bool isVirtualized() const;
+	int getPlaceholderSizeForItem(T* item);
+
 	void setShowAddButton(bool value);
 
 	virtual void paint(Graphics &g) override;
@@ -124,6 +136,7 @@ public:
 	virtual void resizedInternalHeader(juce::Rectangle<int> &r);
 	virtual void resizedInternalContent(juce::Rectangle<int> &r);
 	virtual void placeItems(juce::Rectangle<int>& r);
+	virtual void placeItemsVirtualized(juce::Rectangle<int>& r);
 	virtual void resizedInternalFooter(juce::Rectangle<int> &r);
 
 	virtual void updateItemsVisibility();
@@ -176,6 +189,7 @@ public:
 	virtual void itemRemoved(T * item) override; //must keep this one realtime because the async may cause the target item to already be deleted by the time this function is called
 	virtual void itemsRemoved(Array<T *> items) override;
 	virtual void itemsReorderedAsync();
+	virtual void itemMovedAsync(T * item);
 
 	void newMessage(const typename BaseManager<T>::ManagerEvent &e) override;
 
@@ -227,7 +241,13 @@ BaseManagerUI<M, T, U>::BaseManagerUI(const String& contentName, M* _manager, bo
 	isDraggingOver(false),
 	highlightOnDragOver(true),
 	fixedItemHeight(true),
-	gap(2)
+	gap(2),
+	useVirtualizedList(false),
+	isPlacingVirtualizedItems(false),
+	virtualizedMargin(200),
+	virtualizedItemExtraSize(30),
+	virtualizedDefaultItemSize(24),
+	virtualizedContentSize(0)
 {
 	
 	selectionContourColor = LIGHTCONTOUR_COLOR;
@@ -293,11 +313,44 @@ template<class M, class T, class U>
 void BaseManagerUI<M, T, U>::addExistingItems(bool resizeAfter)
 {
 
-	//add existing items
-	for (auto &t : manager->items) addItemUI(t, false);
+	//add existing items, in virtualized mode they will be created by placeItemsVirtualized when visible
+	if (!isVirtualized())
+	{
+		for (auto& t : manager->items) addItemUI(t, false);
+	}
+
 	if (resizeAfter) resized();
 }
 
+template<class M, class T, class U>
+void BaseManagerUI<M, T, U>::setUseVirtualizedList(bool value)
+{
+	if (useVirtualizedList == value) return;
+	useVirtualizedList = value;
+
+	if (!useVirtualizedList)
+	{
+		for (auto& t : manager->items) if (getUIForItem(t, false) == nullptr) addItemUI(t, false, false);
+		itemsUI.sort(managerComparator);
+	}
+
+	resized();
+}
+
+template<class M, class T, class U>
+bool BaseManagerUI<M, T, U>::isVirtualized() const
+{
+	return useVirtualizedList && useViewport && defaultLayout != FREE;
+}
+
+template<class M, class T, class U>
+int BaseManagerUI<M, T, U>::getPlaceholderSizeForItem(T* item)
+{
+	BaseItem* bi = static_cast<BaseItem*>(item);
+	if (bi->miniMode->boolValue() || bi->listUISize->floatValue() <= 0) return virtualizedDefaultItemSize;
+	return (int)bi->listUISize->floatValue() + virtualizedItemExtraSize;
+}
+
 template<class M, class T, class U>
 void BaseManagerUI<M, T, U>::setShowAddButton(bool value)
 {
@@ -390,7 +443,8 @@ void BaseManagerUI<M, T, U>::paint(Graphics & g)
 		{
 			if (itemsUI.size() > 0)
 			{
-				BaseItemMinimalUI<T> * bui = dynamic_cast<BaseItemMinimalUI<T> *>(itemsUI[currentDropIndex >= 0 ? currentDropIndex : itemsUI.size() - 1]);
+				U* dropUI = isVirtualized() ? getUIForItem(this->manager->items[currentDropIndex >= 0 ? currentDropIndex : this->manager->items.size() - 1], false) : itemsUI[currentDropIndex >= 0 ? currentDropIndex : itemsUI.size() - 1];
+				BaseItemMinimalUI<T> * bui = dynamic_cast<BaseItemMinimalUI<T> *>(dropUI);
 				if (bui != nullptr)
 				{
 					juce::Rectangle<int> buiBounds = getLocalArea(bui, bui->getLocalBounds());
@@ -469,14 +523,16 @@ void BaseManagerUI<M, T, U>::resizedInternalContent(juce::Rectangle<int>& r)
 		r.setY(0);
 	}
 
-	placeItems(r);
+	if (isVirtualized()) placeItemsVirtualized(r);
+	else placeItems(r);
 
 	if (useViewport || resizeOnChildBoundsChanged)
 	{
 		if (defaultLayout == VERTICAL)
 		{
 			float th = 0;
-			if (itemsUI.size() > 0) th = static_cast<BaseItemMinimalUI<T>*>(itemsUI[itemsUI.size() - 1])->getBottom();
+			if (isVirtualized()) th = virtualizedContentSize;
+			else if (itemsUI.size() > 0) th = static_cast<BaseItemMinimalUI<T>*>(itemsUI[itemsUI.size() - 1])->getBottom();
 			//if (grabbingItem != nullptr) th = jmax<int>(th + grabbingItem->getHeight(), viewport.getHeight());
 
 			if (useViewport) container.setSize(getWidth(), th);
@@ -484,7 +540,8 @@ void BaseManagerUI<M, T, U>::resizedInternalContent(juce::Rectangle<int>& r)
 		} else if (defaultLayout == HORIZONTAL)
 		{
 			float tw = 0;
-			if (itemsUI.size() > 0) tw = static_cast<BaseItemMinimalUI<T>*>(itemsUI[itemsUI.size() - 1])->getRight();
+			if (isVirtualized()) tw = virtualizedContentSize;
+			else if (itemsUI.size() > 0) tw = static_cast<BaseItemMinimalUI<T>*>(itemsUI[itemsUI.size() - 1])->getRight();
 			//if (grabbingItem != nullptr) tw = jmax<int>(tw, viewport.getWidth());
 			if (useViewport) container.setSize(tw, getHeight());
 			else this->setSize(tw, getHeight());
@@ -513,6 +570,62 @@ void BaseManagerUI<M, T, U>::placeItems(juce::Rectangle<int>& r)
 	}
 }
 
+template<class M, class T, class U>
+void BaseManagerUI<M, T, U>::placeItemsVirtualized(juce::Rectangle<int>& r)
+{
+	if (isPlacingVirtualizedItems) return; //creating or placing an item UI may trigger a resize
+	isPlacingVirtualizedItems = true;
+
+	bool isVertical = defaultLayout == VERTICAL;
+	int viewStart = (isVertical ? viewport.getViewPositionY() : viewport.getViewPositionX()) - virtualizedMargin;
+	int viewEnd = viewStart + (isVertical ? viewport.getHeight() : viewport.getWidth()) + virtualizedMargin * 2;
+
+	HashMap<T*, U*> outOfViewUIs;
+	for (auto& ui : itemsUI) outOfViewUIs.set(static_cast<BaseItemMinimalUI<T>*>(ui)->item, ui);
+
+	Array<U*> visibleUIs;
+	int pos = isVertical ? r.getY() : r.getX();
+
+	for (auto& item : manager->items)
+	{
+		U* ui = outOfViewUIs[item];
+		int size = ui != nullptr ? (isVertical ? ui->getHeight() : ui->getWidth()) : getPlaceholderSizeForItem(item);
+
+		if (pos + size >= viewStart && pos <= viewEnd)
+		{
+			if (ui == nullptr)
+			{
+				ui = addItemUI(item, false, false);
+				size = isVertical ? ui->getHeight() : ui->getWidth();
+			}
+			else
+			{
+				outOfViewUIs.remove(item);
+			}
+
+			BaseItem* bi = static_cast<BaseItem*>(item);
+			if (bi->miniMode->boolValue() || bi->listUISize->floatValue() <= 0) virtualizedDefaultItemSize = size;
+			else virtualizedItemExtraSize = size - (int)bi->listUISize->floatValue();
+
+			BaseItemMinimalUI<T>* bui = static_cast<BaseItemMinimalUI<T>*>(ui);
+			juce::Rectangle<int> tr = isVertical ? r.withY(pos).withHeight(size) : r.withX(pos).withWidth(size);
+			if (tr != bui->getBounds()) bui->setBounds(tr);
+
+			visibleUIs.add(ui);
+		}
+
+		pos += size + gap;
+	}
+
+	for (typename HashMap<T*, U*>::Iterator it(outOfViewUIs); it.next();) removeItemUI(it.getKey(), false);
+
+	//keep itemsUI in manager order, it only holds the visible UIs
+	for (int i = 0; i < visibleUIs.size(); i++) itemsUI.move(itemsUI.indexOf(visibleUIs[i]), i);
+
+	virtualizedContentSize = jmax(pos - gap, 0);
+	isPlacingVirtualizedItems = false;
+}
+
 template<class M, class T, class U>
 void BaseManagerUI<M, T, U>::resizedInternalFooter(juce::Rectangle<int>& r)
 {
@@ -551,7 +664,7 @@ bool BaseManagerUI<M, T, U>::hitTest(int x, int y)
 	for (auto &i : itemsUI)
 	{
 		Point<int> p(x, y);
-		if (i->getBounds().contains(p))
+		if (i->isVisible() && i->getBounds().contains(p))
 		{
 			Point<int> localP = i->getLocalPoint(this, p);
 			if (i->hitTest(localP.x, localP.y)) return true;
@@ -664,7 +777,11 @@ void BaseManagerUI<M, T, U>::removeItemUI(T * item, bool resizeAndRepaint)
 		MessageManagerLock mmLock; //Ensure this method can be called from another thread than the UI one
 
 		U* tui = getUIForItem(item, false);
-		if (tui == nullptr) return;
+		if (tui == nullptr)
+		{
+			if (isVirtualized() && resizeAndRepaint) resized(); //item was not visible, only the placeholder layout changes
+			return;
+		}
 
 		BaseItemMinimalUI<T>* bui = static_cast<BaseItemMinimalUI<T>*>(tui);
 
@@ -695,7 +812,7 @@ void BaseManagerUI<M, T, U>::removeItemUI(T * item, bool resizeAndRepaint)
 template<class M, class T, class U>
 U * BaseManagerUI<M, T, U>::getUIForItem(T * item, bool directIndexAccess)
 {
-	if (directIndexAccess) return itemsUI[static_cast<BaseManager<T>*>(manager)->items.indexOf(item)];
+	if (directIndexAccess && !isVirtualized()) return itemsUI[static_cast<BaseManager<T>*>(manager)->items.indexOf(item)];
 
 	for (auto &ui : itemsUI) if (static_cast<BaseItemMinimalUI<T>*>(ui)->item == item) return ui; //brute search, not needed if ui/items are synchronized
 	return nullptr;
@@ -710,6 +827,12 @@ int BaseManagerUI<M, T, U>::getContentHeight()
 template<class M, class T, class U>
 void BaseManagerUI<M, T, U>::itemAddedAsync(T * item)
 {
+	if (isVirtualized())
+	{
+		resized();
+		return;
+	}
+
 	addItemUI(item, animateItemOnAdd);
 	if (!animateItemOnAdd) resized();
 }
@@ -717,7 +840,11 @@ void BaseManagerUI<M, T, U>::itemAddedAsync(T * item)
 template<class M, class T, class U>
 void BaseManagerUI<M, T, U>::itemsAddedAsync(Array<T*> items)
 {
-	for (auto &i : items) addItemUI(i, false, false);
+	if (!isVirtualized())
+	{
+		for (auto& i : items) addItemUI(i, false, false);
+	}
+
 	
 	resized();
 	repaint();
@@ -750,6 +877,26 @@ void BaseManagerUI<M, T, U>::itemsReorderedAsync()
 	resized();
 }
 
+template<class M, class T, class U>
+void BaseManagerUI<M, T, U>::itemMovedAsync(T * item)
+{
+	BaseManager<T> * m = static_cast<BaseManager<T>*>(manager);
+
+	if (!isVirtualized())
+	{
+		//only move this item's ui, then check that the order matches in case other items moved since this message was sent
+		int uiIndex = itemsUI.indexOf(getUIForItem(item, false));
+		int newIndex = m->items.indexOf(item);
+		if (uiIndex >= 0 && newIndex >= 0 && newIndex < itemsUI.size()) itemsUI.move(uiIndex, newIndex);
+
+		bool isSynchronized = itemsUI.size() == m->items.size();
+		for (int i = 0; i < itemsUI.size() && isSynchronized; i++) isSynchronized = static_cast<BaseItemMinimalUI<T>*>(itemsUI[i])->item == m->items[i];
+		if (!isSynchronized) itemsUI.sort(managerComparator);
+	}
+
+	resized();
+}
+
 template<class M, class T, class U>
 void BaseManagerUI<M, T, U>::newMessage(const typename BaseManager<T>::ManagerEvent & e)
 {
@@ -761,7 +908,11 @@ void BaseManagerUI<M, T, U>::newMessage(const typename BaseManager<T>::ManagerEv
 		break;
 
 	case BaseManager<T>::ManagerEvent::ITEMS_REORDERED:
-		itemsReorderedAsync();
+		if (e.getItem() == nullptr) itemsReorderedAsync(); //otherwise sent along ITEM_MOVED, already handled
+		break;
+
+	case BaseManager<T>::ManagerEvent::ITEM_MOVED:
+		itemMovedAsync(e.getItem());
 		break;
 
 	case BaseManager<T>::ManagerEvent::ITEMS_ADDED:
@@ -821,8 +972,8 @@ void BaseManagerUI<M, T, U>::itemDropped(const SourceDetails & dragSourceDetails
 			int droppingIndex = getDropIndexForPosition(dragSourceDetails.localPosition);
 			if (itemsUI.contains((U *)bui))
 			{
-				if (itemsUI.indexOf((U*)bui) < droppingIndex) droppingIndex--;
-				if (droppingIndex == -1) droppingIndex = itemsUI.size() - 1;
+				if (this->manager->items.indexOf(bui->item) < droppingIndex) droppingIndex--;
+				if (droppingIndex == -1) droppingIndex = this->manager->items.size() - 1;
 				this->manager->setItemIndex(bui->item, droppingIndex);
 			}
 			else
@@ -831,7 +982,7 @@ void BaseManagerUI<M, T, U>::itemDropped(const SourceDetails & dragSourceDetails
 				T * newItem = manager->addItemFromData(data);
 				if (newItem != nullptr)
 				{
-					if (droppingIndex == -1) droppingIndex = itemsUI.size() - 1;
+					if (droppingIndex == -1) droppingIndex = this->manager->items.size() - 1;
 					this->manager->setItemIndex(newItem, droppingIndex);
 					bui->item->remove();
 				}
@@ -871,8 +1022,10 @@ int BaseManagerUI<M, T, U>::getDropIndexForPosition(Point<int> localPosition)
 		BaseItemMinimalUI<T> * iui = dynamic_cast<BaseItemMinimalUI<T> *>(itemsUI[i]);
 		Point<int> p = getLocalArea(iui, iui->getLocalBounds()).getCentre();
 
-		if (defaultLayout == HORIZONTAL && localPosition.x < p.x) return i;
-		else if (defaultLayout == VERTICAL && localPosition.y < p.y) return i;
+		//indices are manager indices, itemsUI only holds the visible items when virtualized
+		int index = isVirtualized() ? this->manager->items.indexOf(iui->item) : i;
+		if (defaultLayout == HORIZONTAL && localPosition.x < p.x) return index;
+		else if (defaultLayout == VERTICAL && localPosition.y < p.y) return index;
 	}
 
 	return -1;
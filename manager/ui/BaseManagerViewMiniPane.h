@@ -77,7 +77,8 @@ void BaseManagerViewMiniPane<M, T, U>::paint(juce::Graphics& g)
 
 	for (auto& ui : managerUI->itemsUI)
 	{
-		juce::Rectangle<int> b = ui->getBoundsInParent();
+		//with the spatial index, off-screen items are not repositioned, so their component bounds are stale
+		juce::Rectangle<int> b = managerUI->useSpatialIndex ? managerUI->getBoundsInView(managerUI->getItemViewBounds(ui)) : ui->getBoundsInParent();
 		
 		float bx = jmap<float>(b.getX(), itemRealBounds.getX(), itemRealBounds.getRight(), r.getX(), r.getRight());
 		float by = jmap<float>(b.getY(), itemRealBounds.getY(), itemRealBounds.getBottom(), r.getY(), r.getBottom());
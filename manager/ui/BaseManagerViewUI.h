@@ -44,6 +44,16 @@ public:
 
 	double timeSinceLastWheel;
 
+	//Spatial index : items are bucketed in a grid over their view bounds, so panning and zooming only touch the items in view
+	bool useSpatialIndex;
+	float spatialCellSize; //in view units
+	HashMap<int64, Array<U*>> spatialGrid;
+	HashMap<U*, juce::Rectangle<float>> itemsViewBounds;
+	HashSet<U*> visibleItemsUI;
+
+	//Level of detail : below this zoom, items are drawn as rectangles in the manager's paint instead of as components. 0 to disable
+	float lodZoomThreshold;
+
 	Point<int> viewOffset; //in pixels, viewOffset of 0 means zeroPos is at the center of the window
 						   //interaction
 	Point<int> initViewOffset;
@@ -71,6 +81,15 @@ public:
 
 	virtual void updateItemsVisibility() override;
 
+	bool isUsingLOD() const;
+	virtual juce::Rectangle<float> getItemViewBounds(U * itemUI);
+	virtual void updateItemInSpatialIndex(U * itemUI);
+	virtual void removeItemFromSpatialIndex(U * itemUI);
+	virtual void rebuildSpatialIndex();
+	void setUseSpatialIndex(bool value);
+	Array<U*> getItemsUIInViewBounds(const juce::Rectangle<float> &viewBounds);
+	virtual void paintLODItems(Graphics &g);
+
 	virtual void addItemFromMenu(bool isFromAddButton, Point<int> mouseDownPos) override;
 	virtual void addItemFromMenu(T * item, bool isFromAddButton, Point<int> mouseDownPos) override;
 
@@ -90,6 +109,7 @@ public:
 	virtual void setShowPane(bool val);
 
 	virtual void addItemUIInternal(U * se) override; 
+	virtual void removeItemUIInternal(U * se) override;
 
 	//virtual void itemUIGrabbed(BaseItemMinimalUI<T> * se) override;
 
@@ -122,7 +142,10 @@ BaseManagerViewUI<M, T, U>::BaseManagerViewUI(const String& contentName, M* _man
 	viewZoom(1),
 	minZoom(.4f),
 	maxZoom(1),
-	timeSinceLastWheel(0)
+	timeSinceLastWheel(0),
+	useSpatialIndex(false),
+	spatialCellSize(400),
+	lodZoomThreshold(0)
 {
     this->defaultLayout = this->FREE;
 
@@ -249,6 +272,8 @@ void BaseManagerViewUI<M, T, U>::paint(Graphics & g)
 {
 	if(!this->transparentBG) paintBackground(g);
 
+	if (isUsingLOD()) paintLODItems(g);
+
 	if (this->manager->items.size() == 0 && this->noItemText.isNotEmpty())
 	{
 		g.setColour(Colours::white.withAlpha(.4f));
@@ -300,9 +325,15 @@ void BaseManagerViewUI<M, T, U>::resized()
 {
 	juce::Rectangle<int> r = this->getLocalBounds();
 	this->addItemBT->setBounds(r.withSize(24, 24).withX(r.getWidth() - 24));
-	for (auto &tui : this->itemsUI)
+
+	//with the spatial index, only the items in view are positioned, see updateItemsVisibility
+	if (useSpatialIndex) updateItemsVisibility();
+	else
 	{
-		updateViewUIPosition(tui);
+		for (auto& tui : this->itemsUI)
+		{
+			updateViewUIPosition(tui);
+		}
 	}
 
 	if (viewPane != nullptr)
@@ -348,11 +379,36 @@ void BaseManagerViewUI<M, T, U>::updateItemsVisibility()
 {
 	//BaseManagerUI::updateItemsVisibility();
 	juce::Rectangle<int> r = this->getLocalBounds();
-	for (auto& iui : this->itemsUI)
+
+	if (useSpatialIndex)
 	{
-		juce::Rectangle<int> ir = iui->getBounds().getIntersection(r);
-		bool isInsideInspectorBounds = !ir.isEmpty();
-		iui->setVisible(isInsideInspectorBounds);
+		Array<U*> inView;
+		if (!isUsingLOD()) inView = getItemsUIInViewBounds(getViewBounds(r));
+
+		HashSet<U*> newVisibleItems;
+		for (auto& iui : inView) newVisibleItems.add(iui);
+
+		for (typename HashSet<U*>::Iterator it(visibleItemsUI); it.next();)
+		{
+			if (!newVisibleItems.contains(it.getValue())) it.getValue()->setVisible(false);
+		}
+
+		for (auto& iui : inView)
+		{
+			updateViewUIPosition(iui);
+			iui->setVisible(true);
+		}
+
+		visibleItemsUI.swapWith(newVisibleItems);
+	}
+	else
+	{
+		for (auto& iui : this->itemsUI)
+		{
+			juce::Rectangle<int> ir = iui->getBounds().getIntersection(r);
+			bool isInsideInspectorBounds = !ir.isEmpty();
+			iui->setVisible(isInsideInspectorBounds);
+		}
 	}
 
 	if (viewPane != nullptr)
@@ -362,6 +418,158 @@ void BaseManagerViewUI<M, T, U>::updateItemsVisibility()
 	}
 }
 
+template<class M, class T, class U>
+bool BaseManagerViewUI<M, T, U>::isUsingLOD() const
+{
+	return useSpatialIndex && lodZoomThreshold > 0 && viewZoom < lodZoomThreshold;
+}
+
+template<class M, class T, class U>
+juce::Rectangle<float> BaseManagerViewUI<M, T, U>::getItemViewBounds(U* itemUI)
+{
+	const float checkerMultiplier = useCheckersAsUnits ? checkerSize : 1;
+	const float sizeFactor = zoomAffectsItemSize ? checkerMultiplier : minZoom * checkerMultiplier; //if the zoom doesn't scale the items, take the biggest size they can have in view units
+
+	Point<float> size(jmax(itemUI->getWidth(), 1) / sizeFactor, jmax(itemUI->getHeight(), 1) / sizeFactor);
+	Point<float> pos = itemUI->item->viewUIPosition->getPoint();
+	if (centerUIAroundPosition) pos -= size / 2;
+
+	return juce::Rectangle<float>(pos.x, pos.y, size.x, size.y);
+}
+
+template<class M, class T, class U>
+void BaseManagerViewUI<M, T, U>::updateItemInSpatialIndex(U* itemUI)
+{
+	if (!useSpatialIndex || itemUI == nullptr) return;
+
+	removeItemFromSpatialIndex(itemUI);
+
+	juce::Rectangle<float> vb = getItemViewBounds(itemUI);
+	itemsViewBounds.set(itemUI, vb);
+
+	int startX = (int)std::floor(vb.getX() / spatialCellSize);
+	int endX = (int)std::floor(vb.getRight() / spatialCellSize);
+	int startY = (int)std::floor(vb.getY() / spatialCellSize);
+	int endY = (int)std::floor(vb.getBottom() / spatialCellSize);
+
+	for (int cx = startX; cx <= endX; cx++)
+	{
+		for (int cy = startY; cy <= endY; cy++)
+		{
+			spatialGrid.getReference(((int64)cx << 32) | (uint32)cy).add(itemUI);
+		}
+	}
+}
+
+template<class M, class T, class U>
+void BaseManagerViewUI<M, T, U>::removeItemFromSpatialIndex(U* itemUI)
+{
+	if (!itemsViewBounds.contains(itemUI)) return;
+
+	juce::Rectangle<float> vb = itemsViewBounds[itemUI];
+	int startX = (int)std::floor(vb.getX() / spatialCellSize);
+	int endX = (int)std::floor(vb.getRight() / spatialCellSize);
+	int startY = (int)std::floor(vb.getY() / spatialCellSize);
+	int endY = (int)std::floor(vb.getBottom() / spatialCellSize);
+
+	for (int cx = startX; cx <= endX; cx++)
+	{
+		for (int cy = startY; cy <= endY; cy++)
+		{
+			int64 key = ((int64)cx << 32) | (uint32)cy;
+			if (!spatialGrid.contains(key)) continue;
+			Array<U*>& cell = spatialGrid.getReference(key);
+			cell.removeFirstMatchingValue(itemUI);
+			if (cell.isEmpty()) spatialGrid.remove(key);
+		}
+	}
+
+	itemsViewBounds.remove(itemUI);
+	visibleItemsUI.removeValue(itemUI);
+}
+
+template<class M, class T, class U>
+void BaseManagerViewUI<M, T, U>::rebuildSpatialIndex()
+{
+	spatialGrid.clear();
+	itemsViewBounds.clear();
+	for (auto& iui : this->itemsUI) updateItemInSpatialIndex(iui);
+}
+
+template<class M, class T, class U>
+void BaseManagerViewUI<M, T, U>::setUseSpatialIndex(bool value)
+{
+	//only for views whose items are placed with viewUIPosition through updateViewUIPosition / getItemViewBounds
+	if (useSpatialIndex == value) return;
+	useSpatialIndex = value;
+
+	if (useSpatialIndex) rebuildSpatialIndex();
+	else
+	{
+		spatialGrid.clear();
+		itemsViewBounds.clear();
+		visibleItemsUI.clear();
+	}
+
+	resized();
+}
+
+template<class M, class T, class U>
+Array<U*> BaseManagerViewUI<M, T, U>::getItemsUIInViewBounds(const juce::Rectangle<float>& viewBounds)
+{
+	Array<U*> result;
+	HashSet<U*> found; //items spanning multiple cells
+
+	int startX = (int)std::floor(viewBounds.getX() / spatialCellSize);
+	int endX = (int)std::floor(viewBounds.getRight() / spatialCellSize);
+	int startY = (int)std::floor(viewBounds.getY() / spatialCellSize);
+	int endY = (int)std::floor(viewBounds.getBottom() / spatialCellSize);
+
+	if ((int64)(endX - startX + 1) * (endY - startY + 1) > spatialGrid.size())
+	{
+		//view covers more cells than there are filled cells, faster to check the filled ones
+		for (typename HashMap<U*, juce::Rectangle<float>>::Iterator it(itemsViewBounds); it.next();)
+		{
+			if (it.getValue().intersects(viewBounds)) result.add(it.getKey());
+		}
+		return result;
+	}
+
+	for (int cx = startX; cx <= endX; cx++)
+	{
+		for (int cy = startY; cy <= endY; cy++)
+		{
+			int64 key = ((int64)cx << 32) | (uint32)cy;
+			if (!spatialGrid.contains(key)) continue;
+			for (auto& iui : spatialGrid.getReference(key))
+			{
+				if (found.contains(iui) || !itemsViewBounds[iui].intersects(viewBounds)) continue;
+				found.add(iui);
+				result.add(iui);
+			}
+		}
+	}
+
+	return result;
+}
+
+template<class M, class T, class U>
+void BaseManagerViewUI<M, T, U>::paintLODItems(Graphics& g)
+{
+	//all items in view are drawn from their cached view bounds, no component is involved
+	for (auto& iui : getItemsUIInViewBounds(getViewBounds(this->getLocalBounds())))
+	{
+		juce::Rectangle<float> r = getBoundsInView(itemsViewBounds[iui]).toFloat();
+		if (!zoomAffectsItemSize) r.setSize(iui->getWidth(), iui->getHeight());
+
+		BaseItem* bi = iui->baseItem;
+		g.setColour(PANEL_COLOR.withAlpha(bi->enabled->boolValue() ? 1 : .5f));
+		g.fillRect(r);
+		g.setColour(bi->isSelected ? HIGHLIGHT_COLOR : PANEL_COLOR.brighter(.2f));
+		g.drawRect(r, bi->isSelected ? 2 : 1);
+	}
+}
+
 template<class M, class T, class U>
 void BaseManagerViewUI<M, T, U>::addItemFromMenu(bool isFromAddButton, Point<int> mouseDownPos)
 {
@@ -461,8 +669,10 @@ template<class M, class T, class U>
 void BaseManagerViewUI<M, T, U>::setViewZoom(float value)
 {
 	if (viewZoom == value) return;
+	bool wasUsingLOD = isUsingLOD();
 	viewZoom = jlimit<float>(minZoom, maxZoom, value);
 	for (auto &tui : this->itemsUI) tui->setViewZoom(viewZoom);
+	if (wasUsingLOD != isUsingLOD()) this->repaint();
 
 	updateItemsVisibility();
 	this->resized();
@@ -492,6 +702,18 @@ void BaseManagerViewUI<M, T, U>::addItemUIInternal(U * se)
 	se->setViewZoom(viewZoom);
 	if (useCheckersAsUnits) se->setViewCheckerSize(checkerSize); 
 	updateViewUIPosition(se);
+
+	if (useSpatialIndex)
+	{
+		updateItemInSpatialIndex(se);
+		visibleItemsUI.add(se); //new items are visible until the next visibility update
+	}
+}
+
+template<class M, class T, class U>
+void BaseManagerViewUI<M, T, U>::removeItemUIInternal(U* se)
+{
+	removeItemFromSpatialIndex(se);
 }
 
 template<class M, class T, class U>
@@ -527,7 +749,7 @@ void BaseManagerViewUI<M, T, U>::itemDragMove(const DragAndDropTarget::SourceDet
 
 		for (auto& ui : this->itemsUI)
 		{
-			if (ui == bui) continue;
+			if (ui == bui || !ui->isVisible()) continue; //hidden items are not positioned when using the spatial index
 			juce::Rectangle<int> ib = ui->getBounds();
 			
 			int curDistX = distX;
@@ -628,12 +850,14 @@ template<class M, class T, class U>
  void BaseManagerViewUI<M, T, U>::itemUIMiniModeChanged(BaseItemUI<T>* itemUI)
 {
 	updateViewUIPosition(dynamic_cast<U *>(itemUI));
+	updateItemInSpatialIndex(dynamic_cast<U*>(itemUI));
 }
 
  template<class M, class T, class U>
  void BaseManagerViewUI<M, T, U>::itemUIViewPositionChanged(BaseItemMinimalUI<T>* itemUI)
  {
 	 updateViewUIPosition(dynamic_cast<U *>(itemUI));
+	 updateItemInSpatialIndex(dynamic_cast<U*>(itemUI));
  }
 
  template<class M, class T, class U>
@@ -643,6 +867,7 @@ template<class M, class T, class U>
 	 actions.add(itemUI->baseItem->viewUIPosition->setUndoablePoint(itemUI->baseItem->viewUIPosition->getPoint(), getViewPos(itemUI->getPosition()).toFloat(),true));
 	 actions.add(itemUI->baseItem->viewUISize->setUndoablePoint(itemUI->baseItem->viewUISize->getPoint(), Point<float>	(itemUI->getWidth(), itemUI->getHeight()),true));
 	 UndoMaster::getInstance()->performActions("Move / Resize "+itemUI->baseItem->niceName, actions);
+	 updateItemInSpatialIndex(dynamic_cast<U*>(itemUI));
  }
 
 template<class M, class T, class U>
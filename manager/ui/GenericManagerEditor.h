@@ -223,6 +223,12 @@ void GenericManagerEditor<T>::newMessage(const typename BaseManager<T>::ManagerE
 		resized();
 		break;
 
+	case BaseManager<T>::ManagerEvent::ITEMS_ADDED:
+		setCollapsed(false, true);
+		for (auto &i : e.getItems()) itemAddedAsync(i);
+		resized();
+		break;
+
 	case BaseManager<T>::ManagerEvent::ITEM_REMOVED:
 		itemRemovedAsync(e.getItem());
 		resized();
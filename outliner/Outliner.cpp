@@ -222,7 +222,7 @@ OutlinerItemComponent::OutlinerItemComponent(OutlinerItem * _item) :
 {
 	item->addItemListener(this);
 	autoDrawContourWhenSelected = false;
-	setTooltip(item->isContainer ? item->container->getControlAddress() : item->controllable->description + "\nControl Address : " + item->controllable->controlAddress);
+	setTooltip(item->isContainer ? item->container->getControlAddress() : item->controllable->description + "\nControl Address : " + item->controllable->getControlAddress());
 	addAndMakeVisible(&label);
 
 
@@ -299,11 +299,11 @@ void OutlinerItemComponent::mouseDown(const MouseEvent &e)
 		{
 		case -1:
 			if (item->isContainer) SystemClipboard::copyTextToClipboard(item->container->getControlAddress());
-			else SystemClipboard::copyTextToClipboard(item->controllable->controlAddress);
+			else SystemClipboard::copyTextToClipboard(item->controllable->getControlAddress());
 			break;
 		case -2:
 			if (item->isContainer)  SystemClipboard::copyTextToClipboard("root" + item->container->getControlAddress().replaceCharacter('/', '.'));
-			else SystemClipboard::copyTextToClipboard("root" + item->controllable->controlAddress.replaceCharacter('/', '.'));
+			else SystemClipboard::copyTextToClipboard("root" + item->controllable->getControlAddress().replaceCharacter('/', '.'));
 			break;
 
 		default:
@@ -10,8 +10,97 @@
 
 juce_ImplementSingleton(OSCRemoteControl)
 
+OSCFeedbackClient::OSCFeedbackClient() :
+	BaseItem("Client"),
+	lastSendTime(0)
+{
+	remoteHost = addStringParameter("Remote Host", "Host to send the feedback to", "127.0.0.1");
+	remotePort = addIntParameter("Remote Port", "Port to send the feedback to", 12000, 1, 65535);
+	addressFilter = addStringParameter("Address Filter", "If not empty, only addresses matching one of these patterns, separated by commas, are sent. Patterns can use * and ?, like /modules/*", "");
+	maxRate = addIntParameter("Max Rate", "Maximum number of bundles sent per second to this client", 30, 1, 1000);
+	maxBundleSize = addIntParameter("Max Bundle Size", "Maximum size of a bundle in bytes, feedback is split into multiple bundles above this size", 1400, 64, 65000);
+
+	setupSender();
+}
+
+OSCFeedbackClient::~OSCFeedbackClient()
+{
+}
+
+void OSCFeedbackClient::setupSender()
+{
+	sender.disconnect();
+	if (!sender.connect(remoteHost->stringValue(), remotePort->intValue())) NLOGWARNING(niceName, "Could not setup feedback to " << remoteHost->stringValue() << ":" << remotePort->intValue());
+}
+
+bool OSCFeedbackClient::matchesFilter(const String& address) const
+{
+	if (filters.isEmpty()) return true;
+	for (auto& f : filters) if (address.matchesWildcard(f, true)) return true;
+	return false;
+}
+
+void OSCFeedbackClient::addFeedback(Controllable* c)
+{
+	if (pendingFeedbackSet.contains(c) || !matchesFilter(c->getControlAddress())) return;
+	pendingFeedbackSet.add(c);
+	pendingFeedback.add(c);
+}
+
+void OSCFeedbackClient::sendPendingFeedback(uint32 time)
+{
+	if (pendingFeedback.isEmpty()) return;
+	if (time - lastSendTime < (uint32)(1000 / maxRate->intValue())) return;
+
+	lastSendTime = time;
+
+	const int maxSize = maxBundleSize->intValue();
+	OSCBundle bundle;
+	int bundleSize = 16; //"#bundle" and time tag
+
+	for (auto& c : pendingFeedback)
+	{
+		if (c.wasObjectDeleted()) continue;
+
+		OSCMessage m = OSCHelpers::getOSCMessageForControllable(c.get());
+		int messageSize = OSCHelpers::getMessageSize(m) + 4; //element size
+
+		if (bundleSize + messageSize > maxSize && !bundle.isEmpty())
+		{
+			sender.send(bundle);
+			bundle = OSCBundle();
+			bundleSize = 16;
+		}
+
+		bundle.addElement(m);
+		bundleSize += messageSize;
+	}
+
+	if (!bundle.isEmpty()) sender.send(bundle);
+
+	pendingFeedback.clearQuick();
+	pendingFeedbackSet.clear();
+}
+
+void OSCFeedbackClient::onContainerParameterChangedInternal(Parameter* p)
+{
+	if (p == remoteHost || p == remotePort) setupSender();
+	else if (p == addressFilter)
+	{
+		filters.clear();
+		filters.addTokens(addressFilter->stringValue(), ",", "\"");
+		filters.trim();
+		filters.removeEmptyStrings();
+	}
+}
+
+
 OSCRemoteControl::OSCRemoteControl() :
-	EnablingControllableContainer("OSC Remote Control")
+	EnablingControllableContainer("OSC Remote Control"),
+	ingestCC("Realtime Ingest"),
+	ingestFifo(4096),
+	ingestThread(this),
+	feedbackClients("Feedback Clients")
 #if ORGANICUI_USE_SERVUS
 	,Thread("Global Zeroconf")
 	,servus("_osc._udp")
@@ -24,6 +113,24 @@ OSCRemoteControl::OSCRemoteControl() :
 
 	localPort = addIntParameter("Local Port", "Local port to connect to for global control over the application", 42000, 1024, 65535);
 
+	coalesceMessages = ingestCC.addBoolParameter("Coalesce Messages", "If checked, messages are queued and only the last value received for each parameter is applied at the apply rate, instead of applying every message as it arrives", false);
+	applyRate = ingestCC.addIntParameter("Apply Rate", "Number of times per second the queued messages are applied", 60, 1, 1000);
+	messagesPerSecond = ingestCC.addIntParameter("Messages per second", "Number of messages received in the last second", 0, 0);
+	coalescedCount = ingestCC.addIntParameter("Coalesced", "Number of messages that have been replaced by a newer value before being applied", 0, 0);
+	droppedCount = ingestCC.addIntParameter("Dropped", "Number of messages dropped because the queue was full", 0, 0);
+	for (auto& p : { messagesPerSecond, coalescedCount, droppedCount })
+	{
+		p->setControllableFeedbackOnly(true);
+		p->isSavable = false;
+	}
+	addChildControllableContainer(&ingestCC);
+
+	ingestQueue.resize(ingestFifo.getTotalSize());
+
+	feedbackClients.selectItemWhenCreated = false;
+	feedbackClients.addBaseManagerListener(this);
+	addChildControllableContainer(&feedbackClients);
+
 	receiver.addListener(this);
 	receiver.registerFormatErrorHandler(&OSCHelpers::logOSCFormatError);
 
@@ -32,6 +139,10 @@ OSCRemoteControl::OSCRemoteControl() :
 
 OSCRemoteControl::~OSCRemoteControl()
 {
+	ingestThread.stopThread(1000);
+	stopTimer();
+	if (Engine::mainEngine != nullptr) Engine::mainEngine->removeControllableContainerListener(this);
+
 #if ORGANICUI_USE_SERVUS
 	signalThreadShouldExit();
 	waitForThreadToExit(1000);
@@ -44,6 +155,8 @@ void OSCRemoteControl::setupReceiver()
 	//if (receiveCC == nullptr) return;
 
 	receiver.disconnect();
+	setupIngest();
+	setupFeedback();
 
 	if (!enabled->boolValue()) return;
 
@@ -74,6 +187,82 @@ void OSCRemoteControl::setupReceiver()
 	NLOG(niceName, s);
 }
 
+void OSCRemoteControl::setupIngest()
+{
+	bool shouldRun = enabled->boolValue() && coalesceMessages->boolValue();
+	if (shouldRun == ingestThread.isThreadRunning()) return;
+
+	if (shouldRun) ingestThread.startThread();
+	else ingestThread.stopThread(1000);
+}
+
+void OSCRemoteControl::setupFeedback()
+{
+	if (Engine::mainEngine == nullptr) return;
+
+	bool shouldSend = enabled->boolValue() && !feedbackClients.items.isEmpty();
+	if (shouldSend == isTimerRunning()) return;
+
+	if (shouldSend)
+	{
+		Engine::mainEngine->addControllableContainerListener(this);
+		startTimerHz(60);
+	}
+	else
+	{
+		Engine::mainEngine->removeControllableContainerListener(this);
+		stopTimer();
+
+		GenericScopedLock<SpinLock> lock(feedbackLock);
+		pendingFeedback.clear();
+		pendingFeedbackAddresses.clear();
+		pendingFeedbackSet.clear();
+	}
+}
+
+void OSCRemoteControl::addFeedback(Controllable* c)
+{
+	bool isMessageThread = MessageManager::getInstance()->isThisTheMessageThread();
+
+	GenericScopedLock<SpinLock> lock(feedbackLock);
+	if (pendingFeedbackSet.contains(c)) return;
+	pendingFeedbackSet.add(c);
+
+	//the address is resolved again when sending, the controllable may be deleted before that
+	if (isMessageThread) pendingFeedback.add(c);
+	else pendingFeedbackAddresses.add(c->getControlAddress());
+}
+
+void OSCRemoteControl::sendFeedback()
+{
+	Array<WeakReference<Controllable>> changes;
+	StringArray changedAddresses;
+	{
+		GenericScopedLock<SpinLock> lock(feedbackLock);
+		changes.swapWith(pendingFeedback);
+		changedAddresses.swapWith(pendingFeedbackAddresses);
+		pendingFeedbackSet.clear();
+	}
+
+	for (auto& a : changedAddresses)
+	{
+		if (Controllable* c = Engine::mainEngine->getControllableForAddress(a)) changes.add(c);
+	}
+
+	uint32 time = Time::getMillisecondCounter();
+	for (auto& client : feedbackClients.items)
+	{
+		if (!client->enabled->boolValue()) continue;
+		for (auto& c : changes) if (!c.wasObjectDeleted()) client->addFeedback(c.get());
+		client->sendPendingFeedback(time);
+	}
+}
+
+void OSCRemoteControl::timerCallback()
+{
+	sendFeedback();
+}
+
 #if ORGANICUI_USE_SERVUS
 void OSCRemoteControl::setupZeroconf()
 {
@@ -119,6 +308,35 @@ void OSCRemoteControl::processMessage(const OSCMessage& m)
 		MessageManagerLock mmLock;
 		Engine::mainEngine->save(false, false);
 	}
+	else if (add == "/feedback/register")
+	{
+		if (m.size() < 2)
+		{
+			LOGWARNING("Cannot register feedback client, host and port are required");
+			return;
+		}
+
+		String host = OSCHelpers::getStringArg(m[0]);
+		int port = jlimit(1, 65535, OSCHelpers::getIntArg(m[1])); //same range as the port parameter
+
+		MessageManagerLock mmLock;
+
+		//registering again only updates the filter of the existing client
+		for (auto& existing : feedbackClients.items)
+		{
+			if (existing->remoteHost->stringValue() == host && existing->remotePort->intValue() == port)
+			{
+				if (m.size() > 2) existing->addressFilter->setValue(OSCHelpers::getStringArg(m[2]));
+				return;
+			}
+		}
+
+		OSCFeedbackClient* client = new OSCFeedbackClient();
+		client->remoteHost->setValue(host);
+		client->remotePort->setValue(port);
+		if (m.size() > 2) client->addressFilter->setValue(OSCHelpers::getStringArg(m[2]));
+		feedbackClients.addItem(client, var(), false);
+	}
 	else if (add == "/closeApp")
 	{
 		MessageManagerLock mmLock;
@@ -136,15 +354,104 @@ void OSCRemoteControl::processMessage(const OSCMessage& m)
 	}
 }
 
+void OSCRemoteControl::queueMessage(const String& address, bool isTrigger, const OSCMessage& m)
+{
+	int start1, size1, start2, size2;
+	ingestFifo.prepareToWrite(1, start1, size1, start2, size2);
+
+	if (size1 + size2 == 0)
+	{
+		++numDropped;
+		return;
+	}
+
+	IngestMessage& im = ingestQueue.getReference(size1 > 0 ? start1 : start2);
+	im.address = address;
+	im.isTrigger = isTrigger;
+	im.message = m;
+	ingestFifo.finishedWrite(1);
+}
+
+void OSCRemoteControl::applyQueuedMessages()
+{
+	int start1, size1, start2, size2;
+	ingestFifo.prepareToRead(ingestFifo.getNumReady(), start1, size1, start2, size2);
+	if (size1 + size2 == 0) return;
+
+	pendingMessages.clearQuick();
+	pendingIndices.clear();
+
+	for (int i = 0; i < size1 + size2; i++)
+	{
+		const IngestMessage& im = ingestQueue.getReference(i < size1 ? start1 + i : start2 + i - size1);
+
+		//triggers are never coalesced, each one has to be applied
+		if (!im.isTrigger)
+		{
+			if (pendingIndices.contains(im.address))
+			{
+				pendingMessages.getReference(pendingIndices[im.address]).message = im.message;
+				++numCoalesced;
+				continue;
+			}
+
+			pendingIndices.set(im.address, pendingMessages.size());
+		}
+
+		pendingMessages.add(im);
+	}
+
+	ingestFifo.finishedRead(size1 + size2);
+
+	if (Engine::mainEngine == nullptr) return;
+
+	for (auto& im : pendingMessages)
+	{
+		//resolved at apply time, a target removed since the message was queued is skipped
+		if (Controllable* c = Engine::mainEngine->getControllableForAddress(im.address)) OSCHelpers::handleControllableForOSCMessage(c, im.message);
+	}
+}
+
 void OSCRemoteControl::onContainerParameterChanged(Parameter * p)
 {
 	if (p == enabled || p == localPort) setupReceiver();
 }
 
+void OSCRemoteControl::onControllableFeedbackUpdate(ControllableContainer* cc, Controllable* c)
+{
+	if (cc == Engine::mainEngine)
+	{
+		addFeedback(c);
+		return;
+	}
+
+	if (c == coalesceMessages) setupIngest();
+}
+
+void OSCRemoteControl::itemAdded(OSCFeedbackClient*)
+{
+	setupFeedback();
+}
+
+void OSCRemoteControl::itemsAdded(Array<OSCFeedbackClient*>)
+{
+	setupFeedback();
+}
+
+void OSCRemoteControl::itemRemoved(OSCFeedbackClient*)
+{
+	setupFeedback();
+}
+
+void OSCRemoteControl::itemsRemoved(Array<OSCFeedbackClient*>)
+{
+	setupFeedback();
+}
+
 void OSCRemoteControl::oscMessageReceived(const OSCMessage & m)
 {
 	if (!enabled->boolValue()) return;
-	processMessage(m);
+	ingestMessage(m);
 }
 
 void OSCRemoteControl::oscBundleReceived(const OSCBundle & b)
@@ -152,8 +459,51 @@ void OSCRemoteControl::oscBundleReceived(const OSCBundle & b)
 	if (!enabled->boolValue()) return;
 	for (auto &m : b)
 	{
-		processMessage(m.getMessage());
+		if (m.isBundle()) oscBundleReceived(m.getBundle());
+		else ingestMessage(m.getMessage());
+	}
+}
+
+void OSCRemoteControl::ingestMessage(const OSCMessage& m)
+{
+	++numReceived;
+
+	if (!ingestThread.isThreadRunning() || Engine::mainEngine == nullptr)
+	{
+		processMessage(m);
+		return;
 	}
+
+	//resolved here on the network thread only to route the message, commands and unknown addresses (including "enabled" suffixes) go through the direct path
+	String address = m.getAddressPattern().toString();
+	Controllable* c = Engine::mainEngine->getControllableForAddress(address);
+	if (c == nullptr) processMessage(m);
+	else queueMessage(address, c->type == Controllable::TRIGGER, m);
+}
+
+void OSCRemoteControl::IngestThread::run()
+{
+	uint32 lastStatsTime = Time::getMillisecondCounter();
+	int lastReceived = remoteControl->numReceived.get();
+
+	while (!threadShouldExit())
+	{
+		wait(1000 / remoteControl->applyRate->intValue());
+		remoteControl->applyQueuedMessages();
+
+		uint32 t = Time::getMillisecondCounter();
+		if (t - lastStatsTime >= 1000)
+		{
+			int received = remoteControl->numReceived.get();
+			remoteControl->messagesPerSecond->setValue((int)((received - lastReceived) * 1000 / (int)(t - lastStatsTime)));
+			remoteControl->coalescedCount->setValue(remoteControl->numCoalesced.get());
+			remoteControl->droppedCount->setValue(remoteControl->numDropped.get());
+			lastReceived = received;
+			lastStatsTime = t;
+		}
+	}
+
+	remoteControl->applyQueuedMessages(); //don't lose the last values
 }
 
 #if ORGANICUI_USE_SERVUS
@@ -15,13 +15,46 @@
 #include "servus/servus.h"
 #endif
 
+class OSCFeedbackClient :
+	public BaseItem
+{
+public:
+	OSCFeedbackClient();
+	~OSCFeedbackClient();
+
+	StringParameter * remoteHost;
+	IntParameter * remotePort;
+	StringParameter * addressFilter;
+	IntParameter * maxRate;
+	IntParameter * maxBundleSize;
+
+	OSCSender sender;
+	StringArray filters;
+
+	//changes waiting for the rate cap, the values are read when sending
+	Array<WeakReference<Controllable>> pendingFeedback;
+	HashSet<Controllable *> pendingFeedbackSet;
+	uint32 lastSendTime;
+
+	void setupSender();
+	bool matchesFilter(const String &address) const;
+
+	void addFeedback(Controllable * c);
+	void sendPendingFeedback(uint32 time);
+
+	void onContainerParameterChangedInternal(Parameter * p) override;
+
+	String getTypeString() const override { return "OSCFeedbackClient"; }
+};
+
 class OSCRemoteControl :
 	public EnablingControllableContainer,
 #if ORGANICUI_USE_SERVUS
 	public Thread,
 #endif
-	public OSCReceiver::Listener<OSCReceiver::RealtimeCallback>
-
+	public OSCReceiver::Listener<OSCReceiver::RealtimeCallback>,
+	public BaseManagerListener<OSCFeedbackClient>,
+	public Timer
 {
 public: 
 	juce_DeclareSingleton(OSCRemoteControl, true);
@@ -33,7 +66,61 @@ public:
 
 	OSCReceiver receiver;
 
+	//Ingest : messages targeting controllables are queued from the network thread, and values for the same target are coalesced before being applied
+	ControllableContainer ingestCC;
+	BoolParameter * coalesceMessages;
+	IntParameter * applyRate;
+	IntParameter * messagesPerSecond;
+	IntParameter * coalescedCount;
+	IntParameter * droppedCount;
+
+	//the target is kept as an address and resolved again when applied, it may have been deleted while the message was queued
+	struct IngestMessage
+	{
+		String address;
+		bool isTrigger = false;
+		OSCMessage message { OSCAddressPattern("/") };
+	};
+
+	class IngestThread :
+		public Thread
+	{
+	public:
+		IngestThread(OSCRemoteControl * rc) : Thread("OSC Remote Ingest"), remoteControl(rc) {}
+		OSCRemoteControl * remoteControl;
+		void run() override;
+	};
+
+	AbstractFifo ingestFifo;
+	Array<IngestMessage> ingestQueue;
+	Array<IngestMessage> pendingMessages; //only used by the ingest thread
+	HashMap<String, int> pendingIndices; //only used by the ingest thread
+	Atomic<int> numReceived;
+	Atomic<int> numCoalesced;
+	Atomic<int> numDropped;
+	IngestThread ingestThread;
+
+	//Feedback : value changes in the engine are sent back to the registered clients, batched each frame
+	BaseManager<OSCFeedbackClient> feedbackClients;
+	Array<WeakReference<Controllable>> pendingFeedback;
+	StringArray pendingFeedbackAddresses; //changes from other threads, weak references are only created on the message thread
+	HashSet<Controllable *> pendingFeedbackSet;
+	SpinLock feedbackLock;
+
 	void setupReceiver();
+	void setupIngest();
+	void setupFeedback();
+
+	void addFeedback(Controllable * c);
+	void sendFeedback();
+
+	void itemAdded(OSCFeedbackClient *) override;
+	void itemsAdded(Array<OSCFeedbackClient *>) override;
+	void itemRemoved(OSCFeedbackClient *) override;
+	void itemsRemoved(Array<OSCFeedbackClient *>) override;
+
+	void queueMessage(const String &address, bool isTrigger, const OSCMessage &m);
+	void applyQueuedMessages();
 
 #if ORGANICUI_USE_SERVUS
 	servus::Servus servus;
@@ -44,9 +131,13 @@ public:
 
 
 	void onContainerParameterChanged(Parameter * p) override;
+	void onControllableFeedbackUpdate(ControllableContainer * cc, Controllable * c) override;
 	
+	void timerCallback() override;
+
 	void oscMessageReceived(const OSCMessage &m) override;
 	void oscBundleReceived(const OSCBundle &b) override;
+	void ingestMessage(const OSCMessage &m);
 
 #if ORGANICUI_USE_SERVUS
 	void run() override;
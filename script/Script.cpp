@@ -18,6 +18,10 @@ Script::Script(ScriptTarget * _parentTarget, bool canBeDisabled) :
     scriptParamsContainer("params"),
 	parentTarget(_parentTarget),
 	lockedThreadId(0),
+	numExecutions(0),
+	totalExecutionTime(0),
+	longestExecutionTime(0),
+	lastStatsPublishTime(0),
 	scriptAsyncNotifier(10)
 {
 	isSelectable = false;
@@ -28,10 +32,24 @@ Script::Script(ScriptTarget * _parentTarget, bool canBeDisabled) :
 	updateRate = addIntParameter("Update Rate", "The Rate at which the \"update()\" function is called", 50, 1, 1000);
 	updateRate->hideInEditor = true;
 
+	executionBudget = addIntParameter("Execution Budget", "Maximum time in milliseconds a single call to the script can take before being interrupted", 2000, 1, 60000);
+
+	maxExecutionTime = addFloatParameter("Max Execution Time", "Longest call to the script since it was loaded, in milliseconds", 0, 0);
+	maxExecutionTime->setControllableFeedbackOnly(true);
+	maxExecutionTime->isSavable = false;
+
+	avgExecutionTime = addFloatParameter("Average Execution Time", "Average time of a call to the script since it was loaded, in milliseconds", 0, 0);
+	avgExecutionTime->setControllableFeedbackOnly(true);
+	avgExecutionTime->isSavable = false;
+
 	logParam = addBoolParameter("Log", "Utility parameter to easily activate/deactivate logging from the script", false);
 	logParam->setCustomShortName("enableLog");
 	logParam->hideInEditor = true;
 
+	profileParam = addBoolParameter("Profile", "Record call counts and durations of each function of the script. This has a small cost on each call, only activate it when needed", false);
+	profileParam->hideInEditor = true;
+	profileParam->isSavable = false;
+
 	reload = addTrigger("Reload", "Reload the script");
 	reload->hideInEditor = true;
 
@@ -57,12 +75,12 @@ Script::Script(ScriptTarget * _parentTarget, bool canBeDisabled) :
 	addChildControllableContainer(&scriptParamsContainer);
 
 	Engine::mainEngine->addControllableContainerListener(this);
-
-	startTimer(1000); //modification check timer
 }
 
 Script::~Script()
 {
+	if (ScriptWatchdog* w = ScriptWatchdog::getInstanceWithoutCreating()) w->stopWatchingAll(this);
+	if (FileWatcher* w = FileWatcher::getInstanceWithoutCreating()) w->removeAllWatches(this);
 	if(Engine::mainEngine != nullptr) Engine::mainEngine->removeControllableContainerListener(this);
 
 	signalThreadShouldExit();
@@ -82,6 +100,7 @@ void Script::loadScript()
 	setState(SCRIPT_LOADING);
 
 	String path = filePath->getAbsolutePath();
+	updateFileWatch();
 
 	if (path.isEmpty())
 	{
@@ -118,6 +137,7 @@ void Script::loadScript()
 	if (paramsContainerData.isVoid()) paramsContainerData = scriptParamsContainer.getJSONData();
 
 	buildEnvironment();
+	resetExecutionStats();
 
 	//	engineLock.enter();
 	Result result = scriptEngine->execute(s);
@@ -165,8 +185,12 @@ void Script::buildEnvironment()
 	//clear phase
 	setState(SCRIPT_CLEAR);
 
-	scriptEngine.reset(new JavascriptEngine());
-	scriptEngine->maximumExecutionTime = RelativeTime::seconds(2);
+	{
+		GenericScopedLock<SpinLock> lock(engineResetLock);
+		scriptEngine.reset(new JavascriptEngine());
+	}
+
+	scriptEngine->maximumExecutionTime = RelativeTime::milliseconds(executionBudget->intValue());
 	while (scriptParamsContainer.controllables.size() > 0) scriptParamsContainer.removeControllable(scriptParamsContainer.controllables[0]);
 	scriptParamsContainer.clear();
 
@@ -205,14 +229,32 @@ var Script::callFunction(const Identifier & function, const Array<var> args, Res
 		//DBG("Already locked from this thread");
 	}
 
+	//only the outermost call on this thread is watched and timed
+	bool isWatched = ScriptWatchdog::getInstance()->startWatching(this, executionBudget->intValue());
+	if (isWatched) executionInterrupted = 0;
+	double startTime = Time::getMillisecondCounterHiRes();
+
 	var returnData = scriptEngine->callFunction(function, var::NativeFunctionArgs(var::undefined(), (const var*)args.begin(), args.size()), result);
 	
+	double executionTime = Time::getMillisecondCounterHiRes() - startTime;
+	if (isWatched) ScriptWatchdog::getInstance()->stopWatching(this);
+
 	if (needsToEnterLock)
 	{
 		//DBG("Lock Exit " << (int)curThreadId << "(locked " << (int)lockedThreadId << ")");
 		engineLock.exit();
 	}
 
+	if (isWatched) updateExecutionStats(function, executionTime, executionInterrupted.get() != 0);
+
+	if (profiler.isEnabled())
+	{
+		ScriptProfiler::CallingThread callingThread = ScriptProfiler::OTHER_THREAD;
+		if (MessageManager::getInstance()->isThisTheMessageThread()) callingThread = ScriptProfiler::MESSAGE_THREAD;
+		else if (curThreadId == getThreadId()) callingThread = ScriptProfiler::SCRIPT_THREAD;
+		profiler.record(function, executionTime, callingThread);
+	}
+
 	if (result->getErrorMessage().isNotEmpty())
 	{
 		NLOGERROR(niceName, "Script Error :\n" + result->getErrorMessage());
@@ -223,12 +265,84 @@ var Script::callFunction(const Identifier & function, const Array<var> args, Res
 }
 
 
+void Script::interruptExecution()
+{
+	executionInterrupted = 1;
+
+	GenericScopedLock<SpinLock> lock(engineResetLock);
+	if (scriptEngine != nullptr) scriptEngine->stop();
+}
+
+void Script::resetExecutionStats()
+{
+	{
+		GenericScopedLock<SpinLock> lock(statsLock);
+		numExecutions = 0;
+		totalExecutionTime = 0;
+		longestExecutionTime = 0;
+		lastStatsPublishTime = 0;
+	}
+
+	profiler.reset();
+	hasOverrun = 0;
+
+	maxExecutionTime->setValue(0);
+	avgExecutionTime->setValue(0);
+}
+
+void Script::updateExecutionStats(const Identifier& function, double executionTime, bool wasInterrupted)
+{
+	double maxTime = 0;
+	double avgTime = 0;
+	bool shouldPublish = false;
+
+	{
+		GenericScopedLock<SpinLock> lock(statsLock);
+		numExecutions++;
+		totalExecutionTime += executionTime;
+		longestExecutionTime = jmax(longestExecutionTime, executionTime);
+
+		//parameters are only updated a few times per second, update() can be called at a much higher rate
+		double now = Time::getMillisecondCounterHiRes();
+		if (wasInterrupted || now - lastStatsPublishTime > 200)
+		{
+			lastStatsPublishTime = now;
+			maxTime = longestExecutionTime;
+			avgTime = totalExecutionTime / numExecutions;
+			shouldPublish = true;
+		}
+	}
+
+	if (shouldPublish)
+	{
+		maxExecutionTime->setValue(maxTime);
+		avgExecutionTime->setValue(avgTime);
+	}
+
+	if (!wasInterrupted && executionTime <= executionBudget->intValue()) return;
+	if (!hasOverrun.compareAndSetBool(1, 0)) return; //only reported once until the script is reloaded
+
+	//the state stays loaded, so update() and the structure listeners keep running
+	String msg = "Execution of " + function.toString() + " took " + String(executionTime, 1) + "ms, over the budget of " + String(executionBudget->intValue()) + "ms" + (wasInterrupted ? ", it has been interrupted" : "");
+	NLOGWARNING(niceName, msg);
+	setWarningMessage(msg);
+	scriptAsyncNotifier.addMessage(new ScriptEvent(ScriptEvent::STATE_CHANGE));
+}
+
 void Script::onContainerParameterChangedInternal(Parameter * p)
 {
 	if (p == filePath)
 	{
 		if (!isCurrentlyLoadingData) loadScript();
 	}
+	else if (p == executionBudget)
+	{
+		if (scriptEngine != nullptr) scriptEngine->maximumExecutionTime = RelativeTime::milliseconds(executionBudget->intValue());
+	}
+	else if (p == profileParam)
+	{
+		profiler.setEnabled(profileParam->boolValue());
+	}
 }
 
 void Script::onContainerTriggerTriggered(Trigger * t)
@@ -290,15 +404,17 @@ InspectableEditor * Script::getEditor(bool isRoot)
 	return new ScriptEditor(this, isRoot);
 }
 
-void Script::timerCallback()
+void Script::updateFileWatch()
 {
-	//check for modifications
-
+	//missing files are watched too, the script is loaded as soon as the file is created
+	FileWatcher::getInstance()->removeAllWatches(this);
 	File f = filePath->getFile();
-	if (f.getLastModificationTime() != fileLastModTime)
-	{
-		loadScript();
-	}
+	if (f != File()) FileWatcher::getInstance()->addWatch(f, this);
+}
+
+void Script::watchedFileChanged(const File& f)
+{
+	if (f == filePath->getFile() && f.getLastModificationTime() != fileLastModTime) loadScript();
 }
 
 void Script::run()
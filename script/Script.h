@@ -13,9 +13,9 @@ Author:  Ben
 
 class Script :
 	public BaseItem,
-	public Timer,
 	public Thread,
-	public EngineListener
+	public EngineListener,
+	public FileWatcher::Listener
 {
 public:
 	Script(ScriptTarget * parentTarget = nullptr, bool canBeDisabled = true);
@@ -26,8 +26,12 @@ public:
 	String * scriptTemplate;
 	FileParameter * filePath;
 	BoolParameter * logParam;
+	BoolParameter * profileParam;
 	Trigger * reload;
 	IntParameter * updateRate;
+	IntParameter * executionBudget;
+	FloatParameter * maxExecutionTime;
+	FloatParameter * avgExecutionTime;
 
 	ScriptState state;
 	String fileName;
@@ -43,8 +47,20 @@ public:
 
 	std::unique_ptr<JavascriptEngine> scriptEngine;
 	SpinLock engineLock;
+	SpinLock engineResetLock; //held while the engine is replaced, the watchdog can stop it from another thread
 	Thread::ThreadID lockedThreadId;
 
+	//execution stats of the outermost calls, nested calls from callbacks are part of them
+	SpinLock statsLock;
+	int numExecutions;
+	double totalExecutionTime;
+	double longestExecutionTime;
+	double lastStatsPublishTime;
+	Atomic<int> executionInterrupted;
+	Atomic<int> hasOverrun; //a call went over the budget since the script was loaded, the script keeps running
+
+	ScriptProfiler profiler;
+
 	void loadScript();
 	void buildEnvironment();
 
@@ -52,6 +68,10 @@ public:
 
 	var callFunction(const Identifier &function, const Array<var> args, Result * result = (Result *)nullptr);
 
+	void interruptExecution(); //called from the watchdog thread
+	void resetExecutionStats();
+	void updateExecutionStats(const Identifier& function, double executionTime, bool wasInterrupted);
+
 	void onContainerParameterChangedInternal(Parameter *) override;
 	void onContainerTriggerTriggered(Trigger *) override;
 
@@ -66,8 +86,8 @@ public:
 	InspectableEditor * getEditor(bool isRoot) override;
 
 
-	// Inherited via Timer
-	virtual void timerCallback() override;
+	void updateFileWatch();
+	void watchedFileChanged(const File& f) override;
 
 	virtual void run() override;
 	
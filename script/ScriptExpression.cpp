@@ -162,8 +162,7 @@ Array<Parameter*> ScriptExpression::getParameterReferencesInExpression()
 {
 	Array<Parameter*> result;
 	
-	String remainingText = expression;
-	Array<StringArray> matches = RegexFunctions::findSubstringsThatMatchWildcard("(?:root|local)\\.([0-9a-zA-Z\\.]+)\\.get\\(\\)", expression); 
+	Array<StringArray> matches = RegexFunctions::findAllMatches("(?:root|local)\\.([0-9a-zA-Z\\.]+)\\.get\\(\\)", expression); 
 	
 	for (int i = 0; i < matches.size(); i++)
 	{
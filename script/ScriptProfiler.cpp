@@ -0,0 +1,182 @@
+/*
+  ==============================================================================
+
+    ScriptProfiler.cpp
+    Created: 18 Oct 2026 9:43:52pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+ScriptProfiler::ScriptProfiler() :
+	startTime(0)
+{
+}
+
+ScriptProfiler::~ScriptProfiler()
+{
+}
+
+void ScriptProfiler::setEnabled(bool value)
+{
+	if (value == isEnabled()) return;
+
+	if (value)
+	{
+		if (stats == nullptr) stats.reset(new FunctionStats[maxFunctions]);
+		reset();
+	}
+
+	enabled = value ? 1 : 0;
+}
+
+void ScriptProfiler::record(const Identifier& function, double timeMs, CallingThread thread)
+{
+	if (!isEnabled()) return;
+
+	FunctionStats* s = getStats(function, true);
+	if (s == nullptr) return; //table is full
+
+	int64 micros = (int64)(timeMs * 1000);
+
+	s->count += 1;
+	s->totalMicros += micros;
+	s->threadCounts[thread] += 1;
+	s->histogram[getBucketForTime(micros)] += 1;
+
+	for (;;)
+	{
+		int64 curMax = s->maxMicros.get();
+		if (micros <= curMax || s->maxMicros.compareAndSetBool(micros, curMax)) break;
+	}
+}
+
+void ScriptProfiler::reset()
+{
+	if (stats == nullptr) return;
+
+	//names are kept, the slots of functions that are not called anymore are just left empty
+	for (int i = 0; i < maxFunctions; i++)
+	{
+		FunctionStats& s = stats[i];
+		s.count = 0;
+		s.totalMicros = 0;
+		s.maxMicros = 0;
+		for (auto& c : s.threadCounts) c = 0;
+		for (auto& h : s.histogram) h = 0;
+	}
+
+	startTime = Time::getMillisecondCounterHiRes();
+}
+
+ScriptProfiler::FunctionStats* ScriptProfiler::getStats(const Identifier& function, bool createIfNotThere)
+{
+	if (stats == nullptr) return nullptr;
+
+	//identifiers are pooled, the string address is enough to find the slot
+	size_t hash = (size_t)(pointer_sized_int)function.getCharPointer().getAddress();
+	int start = (int)((hash >> 3) % maxFunctions);
+
+	for (int i = 0; i < maxFunctions; i++)
+	{
+		FunctionStats& s = stats[(start + i) % maxFunctions];
+
+		int st = s.state.get();
+		if (st == 0)
+		{
+			if (!createIfNotThere) return nullptr;
+			if (s.state.compareAndSetBool(1, 0))
+			{
+				s.name = function;
+				s.state = 2;
+				return &s;
+			}
+
+			st = s.state.get();
+		}
+
+		while (st == 1) st = s.state.get(); //another thread is claiming this slot, it only writes the name
+		if (s.name == function) return &s;
+	}
+
+	return nullptr;
+}
+
+int ScriptProfiler::getBucketForTime(int64 micros)
+{
+	if (micros <= 0) return 0;
+	return jmin(numBuckets - 1, findHighestSetBit((uint32)jmin<int64>(micros, 0xffffffff)) + 1);
+}
+
+var ScriptProfiler::getJSONData()
+{
+	var data(new DynamicObject());
+	data.getDynamicObject()->setProperty("duration", startTime > 0 ? (Time::getMillisecondCounterHiRes() - startTime) / 1000.0 : 0);
+
+	var bucketsData;
+	for (int i = 0; i < numBuckets; i++) bucketsData.append(i == 0 ? 0 : 1 << (i - 1));
+	data.getDynamicObject()->setProperty("histogramBucketsMicros", bucketsData);
+
+	var functionsData;
+	if (stats != nullptr)
+	{
+		Array<FunctionStats*> sorted;
+		for (int i = 0; i < maxFunctions; i++) if (stats[i].state.get() == 2 && stats[i].count.get() > 0) sorted.add(&stats[i]);
+
+		struct TotalTimeComparator
+		{
+			int compareElements(FunctionStats* a, FunctionStats* b) const { return a->totalMicros.get() > b->totalMicros.get() ? -1 : a->totalMicros.get() < b->totalMicros.get() ? 1 : 0; }
+		};
+		TotalTimeComparator comparator;
+		sorted.sort(comparator);
+
+		for (auto& s : sorted)
+		{
+			int64 count = s->count.get();
+
+			var fData(new DynamicObject());
+			fData.getDynamicObject()->setProperty("name", s->name.toString());
+			fData.getDynamicObject()->setProperty("count", count);
+			fData.getDynamicObject()->setProperty("totalMs", s->totalMicros.get() / 1000.0);
+			fData.getDynamicObject()->setProperty("avgMs", count > 0 ? s->totalMicros.get() / 1000.0 / count : 0);
+			fData.getDynamicObject()->setProperty("maxMs", s->maxMicros.get() / 1000.0);
+
+			var threadData(new DynamicObject());
+			threadData.getDynamicObject()->setProperty("message", s->threadCounts[MESSAGE_THREAD].get());
+			threadData.getDynamicObject()->setProperty("script", s->threadCounts[SCRIPT_THREAD].get());
+			threadData.getDynamicObject()->setProperty("other", s->threadCounts[OTHER_THREAD].get());
+			fData.getDynamicObject()->setProperty("threads", threadData);
+
+			var histogramData;
+			for (auto& h : s->histogram) histogramData.append(h.get());
+			fData.getDynamicObject()->setProperty("histogram", histogramData);
+
+			functionsData.append(fData);
+		}
+	}
+
+	data.getDynamicObject()->setProperty("functions", functionsData);
+	return data;
+}
+
+String ScriptProfiler::getSummary(int maxLines)
+{
+	var functionsData = getJSONData().getProperty("functions", var());
+	if (functionsData.size() == 0) return "No call recorded";
+
+	String s;
+	for (int i = 0; i < functionsData.size() && i < maxLines; i++)
+	{
+		var f = functionsData[i];
+		var t = f.getProperty("threads", var());
+		if (i > 0) s += "\n";
+		s += f.getProperty("name", "").toString() + " : " + f.getProperty("count", 0).toString() + " calls, "
+			+ String((double)f.getProperty("totalMs", 0), 2) + "ms total, "
+			+ String((double)f.getProperty("avgMs", 0), 3) + "ms avg, "
+			+ String((double)f.getProperty("maxMs", 0), 2) + "ms max"
+			+ " (msg " + t.getProperty("message", 0).toString() + " / script " + t.getProperty("script", 0).toString() + " / other " + t.getProperty("other", 0).toString() + ")";
+	}
+
+	if (functionsData.size() > maxLines) s += "\n... " + String(functionsData.size() - maxLines) + " more";
+	return s;
+}
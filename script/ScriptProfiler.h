@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    ScriptProfiler.h
+    Created: 18 Oct 2026 9:43:52pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//Opt-in per-function stats of a script. Recording is lock-free so it can be called from any thread while the script runs,
+//functions get a slot in a fixed size table the first time they are called, the table is only allocated when profiling is first enabled.
+class ScriptProfiler
+{
+public:
+	ScriptProfiler();
+	~ScriptProfiler();
+
+	static const int maxFunctions = 64;
+	static const int numBuckets = 24; //bucket 0 is under 1us, bucket i holds calls from 2^(i-1) to 2^i us, the last one everything above
+
+	enum CallingThread { MESSAGE_THREAD, SCRIPT_THREAD, OTHER_THREAD, NUM_CALLING_THREADS };
+
+	struct FunctionStats
+	{
+		Atomic<int> state; //0 : free, 1 : being claimed, 2 : ready
+		Identifier name;
+
+		Atomic<int64> count;
+		Atomic<int64> totalMicros;
+		Atomic<int64> maxMicros;
+		Atomic<int64> threadCounts[NUM_CALLING_THREADS];
+		Atomic<int64> histogram[numBuckets];
+	};
+
+	Atomic<int> enabled;
+	std::unique_ptr<FunctionStats[]> stats;
+	double startTime;
+
+	void setEnabled(bool value); //message thread only
+	bool isEnabled() const { return enabled.get() != 0; }
+
+	void record(const Identifier& function, double timeMs, CallingThread thread);
+	void reset();
+
+	FunctionStats* getStats(const Identifier& function, bool createIfNotThere);
+	static int getBucketForTime(int64 micros);
+
+	var getJSONData();
+	String getSummary(int maxLines = 10);
+
+	JUCE_DECLARE_NON_COPYABLE(ScriptProfiler)
+};
@@ -42,6 +42,9 @@ ScriptUtil::ScriptUtil() :
 
 	scriptObject.setMethod("copyToClipboard", ScriptUtil::copyToClipboardFromScript);
 	scriptObject.setMethod("getFromClipboard", ScriptUtil::getFromClipboardFromScript);
+
+	scriptObject.setMethod("createRegex", ScriptUtil::createRegexFromScript);
+	scriptObject.setMethod("createByteBuffer", ScriptUtil::createByteBufferFromScript);
 }
 
 var ScriptUtil::getTime(const var::NativeFunctionArgs &)
@@ -321,3 +324,242 @@ var ScriptUtil::getFromClipboardFromScript(const var::NativeFunctionArgs& args)
 {
 	return SystemClipboard::getTextFromClipboard();
 }
+
+var ScriptUtil::createRegexFromScript(const var::NativeFunctionArgs& args)
+{
+	if (args.numArguments == 0) return var();
+
+	String pattern = args.arguments[0].toString();
+	RegexFunctions::CompiledRegex reg = RegexFunctions::getCompiledRegex(pattern);
+	if (reg == nullptr)
+	{
+		LOGWARNING("Invalid regex : " << pattern);
+		return var();
+	}
+
+	return var(new ScriptRegex(pattern, reg));
+}
+
+
+var ScriptUtil::createByteBufferFromScript(const var::NativeFunctionArgs& args)
+{
+	ScriptByteBuffer* b = ScriptByteBuffer::createFromVar(args.numArguments > 0 ? args.arguments[0] : var(0));
+	if (b == nullptr) return var();
+	return var(b);
+}
+
+
+ScriptRegex::ScriptRegex(const String& pattern, RegexFunctions::CompiledRegex reg) :
+	pattern(pattern),
+	reg(reg)
+{
+	setProperty("pattern", pattern);
+	setMethod("test", ScriptRegex::testFromScript);
+	setMethod("match", ScriptRegex::matchFromScript);
+	setMethod("matchAll", ScriptRegex::matchAllFromScript);
+	setMethod("replace", ScriptRegex::replaceFromScript);
+}
+
+ScriptRegex* ScriptRegex::getRegexFromArgs(const var::NativeFunctionArgs& a)
+{
+	return dynamic_cast<ScriptRegex*>(a.thisObject.getDynamicObject());
+}
+
+var ScriptRegex::testFromScript(const var::NativeFunctionArgs& a)
+{
+	ScriptRegex* r = getRegexFromArgs(a);
+	if (r == nullptr || a.numArguments == 0) return false;
+	return RegexFunctions::matchesWildcard(r->reg, a.arguments[0].toString());
+}
+
+var ScriptRegex::matchFromScript(const var::NativeFunctionArgs& a)
+{
+	ScriptRegex* r = getRegexFromArgs(a);
+	if (r == nullptr || a.numArguments == 0) return var();
+
+	StringArray m = RegexFunctions::getFirstMatch(r->reg, a.arguments[0].toString());
+	if (m.isEmpty()) return var();
+	return stringArrayToVar(m);
+}
+
+var ScriptRegex::matchAllFromScript(const var::NativeFunctionArgs& a)
+{
+	ScriptRegex* r = getRegexFromArgs(a);
+	if (r == nullptr || a.numArguments == 0) return var();
+
+	var result = var(Array<var>());
+	for (auto& m : RegexFunctions::findAllMatches(r->reg, a.arguments[0].toString())) result.append(stringArrayToVar(m));
+	return result;
+}
+
+var ScriptRegex::replaceFromScript(const var::NativeFunctionArgs& a)
+{
+	ScriptRegex* r = getRegexFromArgs(a);
+	if (r == nullptr || a.numArguments < 2) return var();
+	return RegexFunctions::replace(r->reg, a.arguments[0].toString(), a.arguments[1].toString());
+}
+
+var ScriptRegex::stringArrayToVar(const StringArray& sa)
+{
+	var result = var(Array<var>());
+	for (auto& s : sa) result.append(s);
+	return result;
+}
+
+
+
+ScriptByteBuffer::ScriptByteBuffer(int size) :
+	block(std::make_shared<MemoryBlock>(jmax(size, 0), true)),
+	start(0),
+	length(jmax(size, 0))
+{
+	registerMethods();
+}
+
+ScriptByteBuffer::ScriptByteBuffer(const void* sourceData, int size) :
+	block(std::make_shared<MemoryBlock>(sourceData, jmax(size, 0))),
+	start(0),
+	length(jmax(size, 0))
+{
+	registerMethods();
+}
+
+ScriptByteBuffer::ScriptByteBuffer(std::shared_ptr<MemoryBlock> block, int start, int length) :
+	block(block),
+	start(start),
+	length(length)
+{
+	registerMethods();
+}
+
+void ScriptByteBuffer::registerMethods()
+{
+	setMethod("size", ScriptByteBuffer::sizeFromScript);
+	setMethod("slice", ScriptByteBuffer::sliceFromScript);
+	setMethod("toArray", ScriptByteBuffer::toArrayFromScript);
+	setMethod("toString", ScriptByteBuffer::toStringFromScript);
+
+	setMethod("readInt8", ScriptByteBuffer::readFromScript<int8>);
+	setMethod("readUint8", ScriptByteBuffer::readFromScript<uint8>);
+	setMethod("readInt16", ScriptByteBuffer::readFromScript<int16>);
+	setMethod("readUint16", ScriptByteBuffer::readFromScript<uint16>);
+	setMethod("readInt32", ScriptByteBuffer::readFromScript<int32>);
+	setMethod("readUint32", ScriptByteBuffer::readFromScript<uint32>);
+	setMethod("readInt64", ScriptByteBuffer::readFromScript<int64>);
+	setMethod("readFloat", ScriptByteBuffer::readFromScript<float>);
+	setMethod("readDouble", ScriptByteBuffer::readFromScript<double>);
+
+	setMethod("writeInt8", ScriptByteBuffer::writeFromScript<int8>);
+	setMethod("writeUint8", ScriptByteBuffer::writeFromScript<uint8>);
+	setMethod("writeInt16", ScriptByteBuffer::writeFromScript<int16>);
+	setMethod("writeUint16", ScriptByteBuffer::writeFromScript<uint16>);
+	setMethod("writeInt32", ScriptByteBuffer::writeFromScript<int32>);
+	setMethod("writeUint32", ScriptByteBuffer::writeFromScript<uint32>);
+	setMethod("writeInt64", ScriptByteBuffer::writeFromScript<int64>);
+	setMethod("writeFloat", ScriptByteBuffer::writeFromScript<float>);
+	setMethod("writeDouble", ScriptByteBuffer::writeFromScript<double>);
+}
+
+bool ScriptByteBuffer::readBytes(int offset, void* dest, int numBytes, bool bigEndian) const
+{
+	if (offset < 0 || numBytes < 0 || (int64)offset > (int64)length - numBytes) return false;
+
+	memcpy(dest, getData() + offset, numBytes);
+	if (bigEndian != ByteOrder::isBigEndian()) std::reverse((uint8*)dest, (uint8*)dest + numBytes);
+	return true;
+}
+
+bool ScriptByteBuffer::writeBytes(int offset, const void* source, int numBytes, bool bigEndian)
+{
+	if (offset < 0 || numBytes < 0 || (int64)offset > (int64)length - numBytes) return false;
+
+	uint8* d = getData() + offset;
+	memcpy(d, source, numBytes);
+	if (bigEndian != ByteOrder::isBigEndian()) std::reverse(d, d + numBytes);
+	return true;
+}
+
+ScriptByteBuffer* ScriptByteBuffer::getBufferFromArgs(const var::NativeFunctionArgs& a)
+{
+	return dynamic_cast<ScriptByteBuffer*>(a.thisObject.getDynamicObject());
+}
+
+int ScriptByteBuffer::getIntFromVar(const var& v, int defaultValue)
+{
+	if (v.isDouble())
+	{
+		double d = (double)v;
+		if (std::isnan(d)) return defaultValue;
+		return (int)jlimit<double>(std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), d);
+	}
+
+	if (v.isInt64()) return (int)jlimit<int64>(std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), (int64)v);
+	if (v.isInt() || v.isBool()) return (int)v;
+	return defaultValue;
+}
+
+ScriptByteBuffer* ScriptByteBuffer::createFromVar(const var& v)
+{
+	if (v.isInt() || v.isInt64() || v.isDouble()) return new ScriptByteBuffer(getIntFromVar(v));
+
+	if (MemoryBlock* mb = v.getBinaryData()) return new ScriptByteBuffer(mb->getData(), (int)mb->getSize());
+
+	if (Array<var>* arr = v.getArray())
+	{
+		ScriptByteBuffer* b = new ScriptByteBuffer(arr->size());
+		uint8* d = b->getData();
+		for (int i = 0; i < arr->size(); i++) d[i] = (uint8)getIntFromVar(arr->getReference(i));
+		return b;
+	}
+
+	if (v.isString())
+	{
+		String s = v.toString();
+		return new ScriptByteBuffer(s.toRawUTF8(), (int)s.getNumBytesAsUTF8());
+	}
+
+	if (ScriptByteBuffer* source = dynamic_cast<ScriptByteBuffer*>(v.getDynamicObject())) return new ScriptByteBuffer(source->getData(), source->length);
+
+	return nullptr;
+}
+
+var ScriptByteBuffer::sizeFromScript(const var::NativeFunctionArgs& a)
+{
+	ScriptByteBuffer* b = getBufferFromArgs(a);
+	return b != nullptr ? b->length : 0;
+}
+
+var ScriptByteBuffer::sliceFromScript(const var::NativeFunctionArgs& a)
+{
+	//same semantics as Array.slice, the memory is shared with this buffer
+	ScriptByteBuffer* b = getBufferFromArgs(a);
+	if (b == nullptr) return var();
+
+	int sliceStart = a.numArguments > 0 ? getIntFromVar(a.arguments[0]) : 0;
+	int sliceEnd = a.numArguments > 1 ? getIntFromVar(a.arguments[1], b->length) : b->length;
+	if (sliceStart < 0) sliceStart += b->length;
+	if (sliceEnd < 0) sliceEnd += b->length;
+	sliceStart = jlimit(0, b->length, sliceStart);
+	sliceEnd = jlimit(sliceStart, b->length, sliceEnd);
+
+	return var(new ScriptByteBuffer(b->block, b->start + sliceStart, sliceEnd - sliceStart));
+}
+
+var ScriptByteBuffer::toArrayFromScript(const var::NativeFunctionArgs& a)
+{
+	ScriptByteBuffer* b = getBufferFromArgs(a);
+	if (b == nullptr) return var();
+
+	Array<var> result;
+	result.ensureStorageAllocated(b->length);
+	const uint8* d = b->getData();
+	for (int i = 0; i < b->length; i++) result.add((int)d[i]);
+	return result;
+}
+
+var ScriptByteBuffer::toStringFromScript(const var::NativeFunctionArgs& a)
+{
+	ScriptByteBuffer* b = getBufferFromArgs(a);
+	if (b == nullptr) return var();
+	return String::fromUTF8((const char*)b->getData(), b->length);
+}
@@ -48,4 +48,84 @@ public:
 	static var copyToClipboardFromScript(const var::NativeFunctionArgs& args);
 	static var getFromClipboardFromScript(const var::NativeFunctionArgs& args);
 
+	static var createRegexFromScript(const var::NativeFunctionArgs& args);
+	static var createByteBufferFromScript(const var::NativeFunctionArgs& args);
+
+};
+
+//Compiled regex given to scripts by util.createRegex, so the pattern is only compiled once
+class ScriptRegex :
+	public DynamicObject
+{
+public:
+	ScriptRegex(const String& pattern, RegexFunctions::CompiledRegex reg);
+	~ScriptRegex() {}
+
+	String pattern;
+	RegexFunctions::CompiledRegex reg;
+
+	static ScriptRegex* getRegexFromArgs(const var::NativeFunctionArgs& a);
+
+	static var testFromScript(const var::NativeFunctionArgs& a);
+	static var matchFromScript(const var::NativeFunctionArgs& a);
+	static var matchAllFromScript(const var::NativeFunctionArgs& a);
+	static var replaceFromScript(const var::NativeFunctionArgs& a);
+
+	static var stringArrayToVar(const StringArray& sa);
+};
+
+//Binary buffer given to scripts by util.createByteBuffer, slices share the same memory
+class ScriptByteBuffer :
+	public DynamicObject
+{
+public:
+	ScriptByteBuffer(int size);
+	ScriptByteBuffer(const void* sourceData, int size);
+	ScriptByteBuffer(std::shared_ptr<MemoryBlock> block, int start, int length);
+	~ScriptByteBuffer() {}
+
+	std::shared_ptr<MemoryBlock> block;
+	int start;
+	int length;
+
+	void registerMethods();
+
+	uint8* getData() const { return (uint8*)block->getData() + start; }
+	bool readBytes(int offset, void* dest, int numBytes, bool bigEndian) const;
+	bool writeBytes(int offset, const void* source, int numBytes, bool bigEndian);
+
+	static ScriptByteBuffer* getBufferFromArgs(const var::NativeFunctionArgs& a);
+	static int getIntFromVar(const var& v, int defaultValue = 0); //doubles out of the int range are clamped instead of overflowing
+	static ScriptByteBuffer* createFromVar(const var& v); //size, array of bytes, binary data or string
+
+	static var sizeFromScript(const var::NativeFunctionArgs& a);
+	static var sliceFromScript(const var::NativeFunctionArgs& a);
+	static var toArrayFromScript(const var::NativeFunctionArgs& a);
+	static var toStringFromScript(const var::NativeFunctionArgs& a);
+
+	//arguments : offset, [bigEndian]
+	template<typename T>
+	static var readFromScript(const var::NativeFunctionArgs& a)
+	{
+		ScriptByteBuffer* b = getBufferFromArgs(a);
+		if (b == nullptr) return var();
+
+		T v;
+		if (!b->readBytes(a.numArguments > 0 ? getIntFromVar(a.arguments[0]) : 0, &v, sizeof(T), a.numArguments > 1 && (bool)a.arguments[1])) return var();
+
+		if (std::is_floating_point<T>::value) return (double)v;
+		if (sizeof(T) < 4 || (sizeof(T) == 4 && std::is_signed<T>::value)) return (int)v;
+		return (int64)v;
+	}
+
+	//arguments : offset, value, [bigEndian]
+	template<typename T>
+	static var writeFromScript(const var::NativeFunctionArgs& a)
+	{
+		ScriptByteBuffer* b = getBufferFromArgs(a);
+		if (b == nullptr || a.numArguments < 2) return false;
+
+		T v = std::is_floating_point<T>::value ? (T)(double)a.arguments[1] : (T)(int64)a.arguments[1];
+		return b->writeBytes(getIntFromVar(a.arguments[0]), &v, sizeof(T), a.numArguments > 2 && (bool)a.arguments[2]);
+	}
 };
@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    ScriptWatchdog.cpp
+    Created: 18 Oct 2026 9:41:15pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+juce_ImplementSingleton(ScriptWatchdog)
+
+ScriptWatchdog::ScriptWatchdog() :
+	Thread("Script Watchdog"),
+	waitDeadline(-1)
+{
+}
+
+ScriptWatchdog::~ScriptWatchdog()
+{
+	signalThreadShouldExit();
+	notify();
+	stopThread(1000);
+}
+
+bool ScriptWatchdog::startWatching(Script* s, int budgetMs)
+{
+	Thread::ThreadID threadId = Thread::getCurrentThreadId();
+	bool shouldWake = false;
+
+	{
+		GenericScopedLock<CriticalSection> lock(callLock);
+		for (auto& c : calls) if (c.script == s && c.threadId == threadId) return false;
+
+		double deadline = Time::getMillisecondCounterHiRes() + budgetMs;
+		calls.add({ s, threadId, deadline });
+
+		//the thread only needs to be woken up if it would check too late for this call
+		shouldWake = waitDeadline < 0 || deadline < waitDeadline;
+		if (shouldWake) waitDeadline = deadline;
+	}
+
+	if (!isThreadRunning()) startThread();
+	else if (shouldWake) notify();
+	return true;
+}
+
+void ScriptWatchdog::stopWatching(Script* s)
+{
+	Thread::ThreadID threadId = Thread::getCurrentThreadId();
+
+	GenericScopedLock<CriticalSection> lock(callLock);
+	for (int i = 0; i < calls.size(); i++)
+	{
+		if (calls[i].script == s && calls[i].threadId == threadId)
+		{
+			calls.remove(i);
+			return;
+		}
+	}
+}
+
+void ScriptWatchdog::stopWatchingAll(Script* s)
+{
+	GenericScopedLock<CriticalSection> lock(callLock);
+	for (int i = calls.size() - 1; i >= 0; i--) if (calls[i].script == s) calls.remove(i);
+}
+
+void ScriptWatchdog::run()
+{
+	while (!threadShouldExit())
+	{
+		double now = Time::getMillisecondCounterHiRes();
+		double nextDeadline = -1;
+
+		{
+			GenericScopedLock<CriticalSection> lock(callLock);
+			for (auto& c : calls)
+			{
+				if (c.deadline <= now)
+				{
+					//the call is still registered so the engine is still running it
+					c.script->interruptExecution();
+					c.deadline = now + 100; //check again if the engine didn't stop yet (e.g. stuck in a native call)
+				}
+
+				if (nextDeadline < 0 || c.deadline < nextDeadline) nextDeadline = c.deadline;
+			}
+
+			waitDeadline = nextDeadline;
+		}
+
+		wait(nextDeadline < 0 ? -1 : jmax(1, (int)(nextDeadline - now)));
+	}
+}
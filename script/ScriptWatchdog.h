@@ -0,0 +1,42 @@
+/*
+  ==============================================================================
+
+    ScriptWatchdog.h
+    Created: 18 Oct 2026 9:41:15pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//Interrupts script calls that run past their execution budget, one thread for all scripts that sleeps while nothing is running
+class ScriptWatchdog :
+	public Thread
+{
+public:
+	juce_DeclareSingleton(ScriptWatchdog, true);
+
+	ScriptWatchdog();
+	~ScriptWatchdog();
+
+	struct WatchedCall
+	{
+		Script* script;
+		Thread::ThreadID threadId;
+		double deadline;
+	};
+
+	CriticalSection callLock;
+	Array<WatchedCall> calls;
+	double waitDeadline; //when the thread will check again by itself, -1 if it waits until notified
+
+	//returns false if this script is already watched for this thread (nested call), in which case stopWatching must not be called
+	bool startWatching(Script* s, int budgetMs);
+	void stopWatching(Script* s);
+	void stopWatchingAll(Script* s);
+
+	void run() override;
+
+	JUCE_DECLARE_NON_COPYABLE(ScriptWatchdog)
+};
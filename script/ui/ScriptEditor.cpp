@@ -25,7 +25,11 @@ ScriptEditor::ScriptEditor(Script * _script, bool isRoot) :
 	}
 
 	logUI.reset(script->logParam->createToggle());
+	profileUI.reset(script->profileParam->createToggle());
 
+	profilerUI.reset(new ScriptProfilerUI(script));
+	addChildComponent(profilerUI.get());
+	profilerUI->setVisible(script->profileParam->boolValue());
 
 	paramsEditor.reset(script->scriptParamsContainer.getEditor(false));
 	addChildComponent(paramsEditor.get());
@@ -33,6 +37,7 @@ ScriptEditor::ScriptEditor(Script * _script, bool isRoot) :
 
 	addAndMakeVisible(reloadBT.get());
 	addAndMakeVisible(logUI.get());
+	addAndMakeVisible(profileUI.get());
 }
 
 ScriptEditor::~ScriptEditor()
@@ -48,7 +53,7 @@ void ScriptEditor::paint(Graphics & g)
 	switch (script->state)
 	{
 	case Script::SCRIPT_LOADED:
-		c = GREEN_COLOR;
+		c = script->hasOverrun.get() != 0 ? HIGHLIGHT_COLOR : GREEN_COLOR;
 		break;
 	case Script::SCRIPT_ERROR:
 		c = RED_COLOR;
@@ -74,6 +79,8 @@ void ScriptEditor::resizedInternalHeaderItemInternal(juce::Rectangle<int>& r)
 	r.removeFromRight(2);
 	logUI->setBounds(r.removeFromRight(40).reduced(2));
 	r.removeFromRight(2);
+	profileUI->setBounds(r.removeFromRight(50).reduced(2));
+	r.removeFromRight(2);
 	reloadBT->setBounds(r.removeFromRight(r.getHeight()).reduced(2));
 	r.removeFromRight(2);
 
@@ -81,6 +88,28 @@ void ScriptEditor::resizedInternalHeaderItemInternal(juce::Rectangle<int>& r)
 	r.removeFromRight(2);
 }
 
+void ScriptEditor::resizedInternalContent(juce::Rectangle<int>& r)
+{
+	BaseItemEditor::resizedInternalContent(r);
+
+	if (profilerUI->isVisible())
+	{
+		profilerUI->setBounds(r.withHeight(profilerUI->getHeight()));
+		r.translate(0, profilerUI->getHeight() + 4);
+	}
+}
+
+void ScriptEditor::controllableFeedbackUpdate(Controllable * c)
+{
+	BaseItemEditor::controllableFeedbackUpdate(c);
+
+	if (c == script->profileParam)
+	{
+		profilerUI->setVisible(script->profileParam->boolValue());
+		resized();
+	}
+}
+
 
 void ScriptEditor::newMessage(const Script::ScriptEvent & e)
 {
@@ -25,6 +25,8 @@ public:
 	std::unique_ptr<TriggerImageUI> reloadBT;
 	std::unique_ptr<ImageButton> editBT;
 	std::unique_ptr<BoolToggleUI> logUI;
+	std::unique_ptr<BoolToggleUI> profileUI;
+	std::unique_ptr<ScriptProfilerUI> profilerUI;
 
 	std::unique_ptr<InspectableEditor> paramsEditor;
 
@@ -32,6 +34,8 @@ public:
 
 	void paint(Graphics &g) override;
 	void resizedInternalHeaderItemInternal(juce::Rectangle<int> &r) override;
+	void resizedInternalContent(juce::Rectangle<int> &r) override;
+	void controllableFeedbackUpdate(Controllable * c) override;
 	void newMessage(const Script::ScriptEvent &e) override;
 
 	void buttonClicked(Button * b) override;
@@ -0,0 +1,81 @@
+/*
+  ==============================================================================
+
+    ScriptProfilerUI.cpp
+    Created: 18 Oct 2026 9:43:52pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+ScriptProfilerUI::ScriptProfilerUI(Script * _script) :
+	script(_script),
+	resetBT("Reset"),
+	exportBT("Export...")
+{
+	summaryLabel.setFont(Font(Font::getDefaultMonospacedFontName(), 11, Font::plain));
+	summaryLabel.setColour(Label::textColourId, TEXT_COLOR);
+	summaryLabel.setJustificationType(Justification::topLeft);
+	addAndMakeVisible(&summaryLabel);
+
+	resetBT.addListener(this);
+	exportBT.addListener(this);
+	addAndMakeVisible(&resetBT);
+	addAndMakeVisible(&exportBT);
+
+	setSize(100, 20 + maxLines * lineHeight + 8);
+	updateSummary();
+	startTimer(500);
+}
+
+ScriptProfilerUI::~ScriptProfilerUI()
+{
+}
+
+void ScriptProfilerUI::updateSummary()
+{
+	summaryLabel.setText(script->profiler.getSummary(maxLines), dontSendNotification);
+}
+
+void ScriptProfilerUI::paint(Graphics & g)
+{
+	g.setColour(BG_COLOR.darker(.1f));
+	g.fillRoundedRectangle(getLocalBounds().toFloat(), 2);
+}
+
+void ScriptProfilerUI::resized()
+{
+	juce::Rectangle<int> r = getLocalBounds().reduced(2);
+	juce::Rectangle<int> hr = r.removeFromTop(16);
+	exportBT.setBounds(hr.removeFromRight(60));
+	hr.removeFromRight(2);
+	resetBT.setBounds(hr.removeFromRight(50));
+	r.removeFromTop(2);
+	summaryLabel.setBounds(r);
+}
+
+void ScriptProfilerUI::buttonClicked(Button * b)
+{
+	if (b == &resetBT)
+	{
+		script->profiler.reset();
+		updateSummary();
+	}
+	else if (b == &exportBT)
+	{
+		FileChooser chooser("Export profile", File::getSpecialLocation(File::userDocumentsDirectory).getChildFile(script->niceName + "_profile.json"), "*.json");
+		if (!chooser.browseForFileToSave(true)) return;
+
+		var data = script->profiler.getJSONData();
+		data.getDynamicObject()->setProperty("script", script->niceName);
+
+		File f = chooser.getResult();
+		if (f.replaceWithText(JSON::toString(data))) NLOG(script->niceName, "Profile exported to " + f.getFullPathName());
+		else NLOGERROR(script->niceName, "Could not write profile to " + f.getFullPathName());
+	}
+}
+
+void ScriptProfilerUI::timerCallback()
+{
+	if (isShowing() && script->profiler.isEnabled()) updateSummary();
+}
@@ -0,0 +1,38 @@
+/*
+  ==============================================================================
+
+    ScriptProfilerUI.h
+    Created: 18 Oct 2026 9:43:52pm
+    Author:  agent
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class ScriptProfilerUI :
+	public Component,
+	public Button::Listener,
+	public Timer
+{
+public:
+	ScriptProfilerUI(Script * script);
+	~ScriptProfilerUI();
+
+	Script * script;
+
+	Label summaryLabel;
+	TextButton resetBT;
+	TextButton exportBT;
+
+	const int maxLines = 10;
+	const int lineHeight = 14;
+
+	void updateSummary();
+
+	void paint(Graphics &g) override;
+	void resized() override;
+
+	void buttonClicked(Button * b) override;
+	void timerCallback() override;
+};
@@ -11,8 +11,11 @@
 juce_ImplementSingleton(UndoMaster);
 
 UndoMaster::UndoMaster() :
-	isPerforming(false)
+	isPerforming(false),
+	coalesceTimeMs(500),
+	lastCoalescableTime(0)
 {
+	setMemoryBudget(32 * 1024 * 1024);
 }
 
 UndoMaster::~UndoMaster() 
@@ -22,10 +25,22 @@ UndoMaster::~UndoMaster()
 void UndoMaster::performAction(const String & name, UndoableAction * action)
 {
 	if (Engine::mainEngine != nullptr && Engine::mainEngine->isLoadingFile) return;
+
+	//no new transaction means the action is added to the last one, where UndoManager merges it with createCoalescedAction
+	Controllable* coalescable = nullptr;
+	if (Parameter::ParameterSetValueAction* pa = dynamic_cast<Parameter::ParameterSetValueAction*>(action)) coalescable = pa->parameterRef.get();
+
+	const uint32 time = Time::getMillisecondCounter();
+	bool coalesce = coalescable != nullptr && coalescable == lastCoalescableControllable.get() && time - lastCoalescableTime < (uint32)coalesceTimeMs && !canRedo();
+
 	isPerforming = true;
-	beginNewTransaction(name);
+	if (!coalesce) beginNewTransaction(name);
 	perform(action,name);
 	isPerforming = false;
+
+	lastCoalescableControllable = coalescable;
+	lastCoalescableTime = time;
+
 	if (Engine::mainEngine != nullptr) Engine::mainEngine->changed();
 }
 
@@ -36,5 +51,188 @@ void UndoMaster::performActions(const String & name, Array<UndoableAction*> acti
 	beginNewTransaction(name);
 	for (auto &a : actions) perform(a,name);
 	isPerforming = false;
+	lastCoalescableControllable = nullptr;
 	if (Engine::mainEngine != nullptr) Engine::mainEngine->changed();
 }
+
+void UndoMaster::setMemoryBudget(int maxBytes, int minTransactionsToKeep)
+{
+	setMaxNumberOfStoredUnits(maxBytes, minTransactionsToKeep);
+}
+
+int UndoMaster::getMemoryUsage() const
+{
+	return getNumberOfUnitsTakenUpByStoredCommands();
+}
+
+int UndoMaster::getVarSize(const var& v)
+{
+	int size = sizeof(var);
+	if (v.isString()) size += v.toString().getNumBytesAsUTF8();
+	else if (Array<var>* a = v.getArray())
+	{
+		for (auto& av : *a) size += getVarSize(av);
+	}
+	else if (DynamicObject* o = v.getDynamicObject())
+	{
+		for (auto& p : o->getProperties()) size += p.name.toString().getNumBytesAsUTF8() + getVarSize(p.value);
+	}
+
+	return size;
+}
+
+MemoryBlock UndoMaster::compressData(const var& data)
+{
+	MemoryBlock block;
+	if (data.isVoid()) return block;
+
+	//binary var encoding instead of JSON text : no number formatting, and property names / repeated strings (types, addresses) are only stored once
+	MemoryOutputStream os(block, false);
+	{
+		GZIPCompressorOutputStream gzip(os);
+		HashMap<String, int> stringIndices;
+		writeBinaryVar(gzip, data, stringIndices);
+	}
+
+	return block;
+}
+
+var UndoMaster::decompressData(const MemoryBlock& block)
+{
+	if (block.isEmpty()) return var();
+
+	MemoryInputStream is(block, false);
+	GZIPDecompressorInputStream gzip(is);
+	StringArray strings;
+	return readBinaryVar(gzip, strings);
+}
+
+void UndoMaster::writeBinaryString(OutputStream& os, const String& s, HashMap<String, int>& stringIndices)
+{
+	//0 followed by the string the first time it's seen, then its index + 1
+	if (stringIndices.contains(s))
+	{
+		os.writeCompressedInt(stringIndices[s] + 1);
+		return;
+	}
+
+	os.writeCompressedInt(0);
+	os.writeString(s);
+	stringIndices.set(s, stringIndices.size());
+}
+
+String UndoMaster::readBinaryString(InputStream& is, StringArray& strings)
+{
+	int index = is.readCompressedInt();
+	if (index > 0) return strings[index - 1];
+
+	String s = is.readString();
+	strings.add(s);
+	return s;
+}
+
+void UndoMaster::writeBinaryVar(OutputStream& os, const var& v, HashMap<String, int>& stringIndices)
+{
+	if (v.isUndefined()) os.writeByte(BINARY_UNDEFINED);
+	else if (v.isBool()) os.writeByte((bool)v ? BINARY_TRUE : BINARY_FALSE);
+	else if (v.isInt())
+	{
+		os.writeByte(BINARY_INT);
+		os.writeCompressedInt((int)v);
+	}
+	else if (v.isInt64())
+	{
+		os.writeByte(BINARY_INT64);
+		os.writeInt64((int64)v);
+	}
+	else if (v.isDouble())
+	{
+		//most parameter values survive a round trip through float, halving their size
+		double d = v;
+		if ((double)(float)d == d)
+		{
+			os.writeByte(BINARY_FLOAT);
+			os.writeFloat((float)d);
+		}
+		else
+		{
+			os.writeByte(BINARY_DOUBLE);
+			os.writeDouble(d);
+		}
+	}
+	else if (v.isString())
+	{
+		os.writeByte(BINARY_STRING);
+		writeBinaryString(os, v.toString(), stringIndices);
+	}
+	else if (Array<var>* a = v.getArray())
+	{
+		os.writeByte(BINARY_ARRAY);
+		os.writeCompressedInt(a->size());
+		for (auto& av : *a) writeBinaryVar(os, av, stringIndices);
+	}
+	else if (DynamicObject* o = v.getDynamicObject())
+	{
+		os.writeByte(BINARY_OBJECT);
+		const NamedValueSet& props = o->getProperties();
+		os.writeCompressedInt(props.size());
+		for (auto& p : props)
+		{
+			writeBinaryString(os, p.name.toString(), stringIndices);
+			writeBinaryVar(os, p.value, stringIndices);
+		}
+	}
+	else if (MemoryBlock* b = v.getBinaryData())
+	{
+		os.writeByte(BINARY_DATA);
+		os.writeCompressedInt((int)b->getSize());
+		os.write(b->getData(), b->getSize());
+	}
+	else os.writeByte(BINARY_VOID); //methods and other objects are not stored, as with JSON
+}
+
+var UndoMaster::readBinaryVar(InputStream& is, StringArray& strings)
+{
+	switch (is.readByte())
+	{
+	case BINARY_UNDEFINED: return var::undefined();
+	case BINARY_FALSE: return false;
+	case BINARY_TRUE: return true;
+	case BINARY_INT: return is.readCompressedInt();
+	case BINARY_INT64: return is.readInt64();
+	case BINARY_FLOAT: return (double)is.readFloat();
+	case BINARY_DOUBLE: return is.readDouble();
+	case BINARY_STRING: return readBinaryString(is, strings);
+
+	case BINARY_ARRAY:
+	{
+		Array<var> result;
+		int numItems = is.readCompressedInt();
+		for (int i = 0; i < numItems && !is.isExhausted(); i++) result.add(readBinaryVar(is, strings));
+		return result;
+	}
+
+	case BINARY_OBJECT:
+	{
+		var result(new DynamicObject());
+		int numProps = is.readCompressedInt();
+		for (int i = 0; i < numProps && !is.isExhausted(); i++)
+		{
+			String name = readBinaryString(is, strings);
+			result.getDynamicObject()->setProperty(name, readBinaryVar(is, strings));
+		}
+		return result;
+	}
+
+	case BINARY_DATA:
+	{
+		MemoryBlock b;
+		is.readIntoMemoryBlock(b, jmax(0, is.readCompressedInt()));
+		return var(b);
+	}
+
+	default: break;
+	}
+
+	return var();
+}
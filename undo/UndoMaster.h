@@ -20,6 +20,29 @@ public:
 
 	bool isPerforming;
 
+	//Consecutive value changes on the same parameter within this window are merged into one undo step
+	int coalesceTimeMs;
+	WeakReference<Controllable> lastCoalescableControllable;
+	uint32 lastCoalescableTime;
+
 	void performAction(const String &name, UndoableAction *action);
 	void performActions(const String &name, Array<UndoableAction *> actions);
+
+	//Actions report their size in bytes, so the budget is in bytes as well. Oldest transactions are removed first when it's exceeded
+	void setMemoryBudget(int maxBytes, int minTransactionsToKeep = 10);
+	int getMemoryUsage() const;
+
+	static int getVarSize(const var &v);
+
+	//Compact gzipped binary encoding of var data kept in the undo history
+	static MemoryBlock compressData(const var &data);
+	static var decompressData(const MemoryBlock &block);
+
+private:
+	enum BinaryVarType { BINARY_VOID, BINARY_UNDEFINED, BINARY_FALSE, BINARY_TRUE, BINARY_INT, BINARY_INT64, BINARY_FLOAT, BINARY_DOUBLE, BINARY_STRING, BINARY_ARRAY, BINARY_OBJECT, BINARY_DATA };
+
+	static void writeBinaryVar(OutputStream &os, const var &v, HashMap<String, int> &stringIndices);
+	static var readBinaryVar(InputStream &is, StringArray &strings);
+	static void writeBinaryString(OutputStream &os, const String &s, HashMap<String, int> &stringIndices);
+	static String readBinaryString(InputStream &is, StringArray &strings);
 };